@@ -26,8 +26,10 @@
 #include "Vehicles/VehicleTail.h"
 #include <OpenLoco/Core/Exception.hpp>
 #include <OpenLoco/Core/FileStream.h>
+#include <algorithm>
 #include <array>
 #include <cassert>
+#include <limits>
 #include <numeric>
 #include <unordered_map>
 
@@ -688,28 +690,35 @@ namespace OpenLoco::Audio
         }
     }
 
-    // 0x0048A268
-    static void triggerVehicleSoundIfInView(Vehicles::VehicleBase& v, Vehicles::VehicleSound& soundParams)
+    struct AudibleViewport
     {
-        if (soundParams.drivingSoundId == SoundObjectId::null)
-        {
-            return;
-        }
+        ViewportRect rect;
+        int32_t rotation;
+        WindowType type;
+        WindowNumber_t number;
+    };
 
-        // TODO: left or top?
-        if (v.spriteLeft == Location::null)
-        {
-            return;
-        }
+    struct VehicleSoundCandidate
+    {
+        Vehicles::VehicleBase* vehicle;
+        Vehicles::VehicleSound* sound;
+        int32_t volume;
+    };
 
-        if (_numActiveVehicleSounds >= kMaxVehicleSounds)
-        {
-            return;
-        }
+    // Vertical margin (in viewport units) that heights can raise a vehicle into view by. Matches the margin used when painting.
+    static constexpr int16_t kAudibleViewportMaxHeight = 1040;
+    // Zoomed out viewports can cover more tiles than it is worth walking the entity spatial index for
+    static constexpr int32_t kMaxSpatialQueryTiles = 128 * 128;
 
-        auto spritePosition = viewport_pos(v.spriteLeft, v.spriteTop);
+    static std::vector<AudibleViewport> _audibleViewports;
+    static std::vector<VehicleSoundCandidate> _vehicleSoundCandidates;
+    static std::vector<EntityId> _flaggedVehicleSounds;
+
+    // Main viewport first (extended by a quarter on each side) then all other viewports from the top down
+    static void updateAudibleViewports()
+    {
+        _audibleViewports.clear();
 
-        // First, check if vehicle appears in the main viewport
         auto main = WindowManager::getMainWindow();
         if (main != nullptr && main->viewports[0] != nullptr)
         {
@@ -723,33 +732,14 @@ namespace OpenLoco::Audio
             extendedViewport.right = viewport->viewX + viewport->viewWidth + quarterWidth;
             extendedViewport.bottom = viewport->viewY + viewport->viewHeight + quarterHeight;
 
-            if (extendedViewport.contains(spritePosition))
-            {
-                // jump + return
-                _numActiveVehicleSounds += 1;
-                soundParams.soundFlags |= Vehicles::SoundFlags::flag0;
-                soundParams.soundWindowType = main->type;
-                soundParams.soundWindowNumber = main->number;
-                return;
-            }
-        }
-
-        if (WindowManager::count() == 0)
-        {
-            return;
+            _audibleViewports.push_back({ extendedViewport, viewport->getRotation(), main->type, main->number });
         }
 
-        // Check if vehicle appears in any other (windowed) viewport
         for (auto i = (int32_t)WindowManager::count() - 1; i >= 0; i--)
         {
             auto w = WindowManager::get(i);
 
-            if (w->type == WindowType::main)
-            {
-                continue;
-            }
-
-            if (w->type == WindowType::news)
+            if (w->type == WindowType::main || w->type == WindowType::news)
             {
                 continue;
             }
@@ -760,60 +750,193 @@ namespace OpenLoco::Audio
                 continue;
             }
 
-            if (viewport->contains(spritePosition))
+            // ViewportRect::contains excludes the left and top edges whereas Viewport::contains includes them
+            ViewportRect rect = {};
+            rect.left = viewport->viewX - 1;
+            rect.top = viewport->viewY - 1;
+            rect.right = viewport->viewX + viewport->viewWidth - 1;
+            rect.bottom = viewport->viewY + viewport->viewHeight - 1;
+
+            _audibleViewports.push_back({ rect, viewport->getRotation(), w->type, w->number });
+        }
+    }
+
+    static const AudibleViewport* findAudibleViewport(const viewport_pos& spritePosition)
+    {
+        for (const auto& audibleViewport : _audibleViewports)
+        {
+            if (audibleViewport.rect.contains(spritePosition))
             {
-                _numActiveVehicleSounds += 1;
-                soundParams.soundFlags |= Vehicles::SoundFlags::flag0;
-                soundParams.soundWindowType = w->type;
-                soundParams.soundWindowNumber = w->number;
-                return;
+                return &audibleViewport;
             }
         }
+        return nullptr;
     }
 
-    // 0x004FEB58
-    static void processVehicleForSound(Vehicles::VehicleBase& v, Vehicles::VehicleSound& soundParams, int32_t step)
+    // 0x0048A268
+    static void considerVehicleForSound(Vehicles::VehicleBase& v, Vehicles::VehicleSound& soundParams)
     {
-        switch (step)
+        if (soundParams.drivingSoundId == SoundObjectId::null)
         {
-            case 0:
-                // 0x048A262
-                soundParams.soundFlags &= ~Vehicles::SoundFlags::flag0;
-                break;
-            case 1:
-                // 0x048A268
-                if ((soundParams.soundFlags & Vehicles::SoundFlags::flag1) == Vehicles::SoundFlags::none)
-                {
-                    triggerVehicleSoundIfInView(v, soundParams);
-                }
-                break;
-            case 2:
-                // 0x048A395
-                if ((soundParams.soundFlags & Vehicles::SoundFlags::flag1) != Vehicles::SoundFlags::none)
+            return;
+        }
+
+        // TODO: left or top?
+        if (v.spriteLeft == Location::null)
+        {
+            return;
+        }
+
+        const auto* audibleViewport = findAudibleViewport(viewport_pos(v.spriteLeft, v.spriteTop));
+        if (audibleViewport == nullptr)
+        {
+            return;
+        }
+
+        soundParams.soundWindowType = audibleViewport->type;
+        soundParams.soundWindowNumber = audibleViewport->number;
+        _vehicleSoundCandidates.push_back({ &v, &soundParams, getVehicleSoundVolume(v, soundParams) });
+    }
+
+    static void considerEntityForSound(EntityBase& entity)
+    {
+        auto* v = entity.asBase<Vehicles::VehicleBase>();
+        if (v == nullptr || !v->hasSoundPlayer())
+        {
+            return;
+        }
+        considerVehicleForSound(*v, *v->getVehicleSound());
+    }
+
+    // Map area (in tiles) that could appear within the viewport rect
+    static std::pair<World::TilePos2, World::TilePos2> getAudibleViewportTileBounds(const AudibleViewport& audibleViewport)
+    {
+        const auto& rect = audibleViewport.rect;
+        auto clampViewCoord = [](int32_t coord) { return static_cast<int16_t>(std::clamp<int32_t>(coord, std::numeric_limits<int16_t>::min() / 2, std::numeric_limits<int16_t>::max() / 2)); };
+        const auto left = clampViewCoord(rect.left);
+        const auto right = clampViewCoord(rect.right);
+        const auto top = clampViewCoord(rect.top);
+        const auto bottom = clampViewCoord(rect.bottom);
+
+        const std::array<World::Pos2, 8> corners = {
+            viewportCoordToMapCoord(left, top, 0, audibleViewport.rotation),
+            viewportCoordToMapCoord(right, top, 0, audibleViewport.rotation),
+            viewportCoordToMapCoord(left, bottom, 0, audibleViewport.rotation),
+            viewportCoordToMapCoord(right, bottom, 0, audibleViewport.rotation),
+            viewportCoordToMapCoord(left, top, kAudibleViewportMaxHeight, audibleViewport.rotation),
+            viewportCoordToMapCoord(right, top, kAudibleViewportMaxHeight, audibleViewport.rotation),
+            viewportCoordToMapCoord(left, bottom, kAudibleViewportMaxHeight, audibleViewport.rotation),
+            viewportCoordToMapCoord(right, bottom, kAudibleViewportMaxHeight, audibleViewport.rotation),
+        };
+
+        World::Pos2 min = corners[0];
+        World::Pos2 max = corners[0];
+        for (const auto& corner : corners)
+        {
+            min.x = std::min(min.x, corner.x);
+            min.y = std::min(min.y, corner.y);
+            max.x = std::max(max.x, corner.x);
+            max.y = std::max(max.y, corner.y);
+        }
+
+        const auto minTile = World::toTileSpace(World::Pos2(World::clampCoord(min.x), World::clampCoord(min.y)));
+        const auto maxTile = World::toTileSpace(World::Pos2(World::clampCoord(max.x), World::clampCoord(max.y)));
+        return { minTile, maxTile };
+    }
+
+    // Collects every vehicle sound that is within an audible viewport. Rather than visiting every vehicle
+    // the entity spatial index is walked over the tiles beneath each viewport so that off screen vehicles
+    // cost nothing.
+    static void collectVehicleSoundCandidates()
+    {
+        _vehicleSoundCandidates.clear();
+
+        int32_t numTiles = 0;
+        std::vector<std::pair<World::TilePos2, World::TilePos2>> tileBounds;
+        for (const auto& audibleViewport : _audibleViewports)
+        {
+            const auto [minTile, maxTile] = getAudibleViewportTileBounds(audibleViewport);
+            numTiles += (maxTile.x - minTile.x + 1) * (maxTile.y - minTile.y + 1);
+            tileBounds.emplace_back(minTile, maxTile);
+        }
+
+        if (numTiles > kMaxSpatialQueryTiles)
+        {
+            for (auto* head : VehicleManager::VehicleList())
+            {
+                Vehicles::Vehicle train(*head);
+                considerVehicleForSound(*train.veh2, train.veh2->sound);
+                considerVehicleForSound(*train.tail, train.tail->sound);
+            }
+            return;
+        }
+
+        for (const auto& [minTile, maxTile] : tileBounds)
+        {
+            for (auto tileY = minTile.y; tileY <= maxTile.y; ++tileY)
+            {
+                for (auto tileX = minTile.x; tileX <= maxTile.x; ++tileX)
                 {
-                    triggerVehicleSoundIfInView(v, soundParams);
+                    for (auto* entity : EntityManager::EntityTileList(World::toWorldSpace(World::TilePos2(tileX, tileY))))
+                    {
+                        considerEntityForSound(*entity);
+                    }
                 }
-                break;
-            case 3:
-                playSound(v.id, soundParams);
-                break;
+            }
         }
+
+        // Viewports can overlap so the same vehicle may have been found more than once
+        std::sort(std::begin(_vehicleSoundCandidates), std::end(_vehicleSoundCandidates), [](const auto& lhs, const auto& rhs) { return lhs.vehicle < rhs.vehicle; });
+        auto last = std::unique(std::begin(_vehicleSoundCandidates), std::end(_vehicleSoundCandidates), [](const auto& lhs, const auto& rhs) { return lhs.vehicle == rhs.vehicle; });
+        _vehicleSoundCandidates.erase(last, std::end(_vehicleSoundCandidates));
     }
 
     // 0x0048A1FA
-    static void processVehicleSounds(int32_t step)
+    // Flags (SoundFlags::flag0) the loudest vehicle sounds in view that fit within the vehicle channels.
+    // As in vanilla sounds without SoundFlags::flag1 take priority.
+    static void processVehicleSounds()
     {
-        if (step == 0)
+        for (auto id : _flaggedVehicleSounds)
+        {
+            auto* v = EntityManager::get<Vehicles::VehicleBase>(id);
+            if (v != nullptr && v->hasSoundPlayer())
+            {
+                v->getVehicleSound()->soundFlags &= ~Vehicles::SoundFlags::flag0;
+            }
+        }
+        _flaggedVehicleSounds.clear();
+
+        updateAudibleViewports();
+        if (_audibleViewports.empty())
         {
             _numActiveVehicleSounds = 0;
+            return;
         }
+        collectVehicleSoundCandidates();
+
+        const auto budget = std::min<size_t>({ kMaxVehicleSounds, _vehicleChannels.size(), _vehicleSoundCandidates.size() });
+        auto isLouder = [](const VehicleSoundCandidate& lhs, const VehicleSoundCandidate& rhs) {
+            const auto lhsDeferred = (lhs.sound->soundFlags & Vehicles::SoundFlags::flag1) != Vehicles::SoundFlags::none;
+            const auto rhsDeferred = (rhs.sound->soundFlags & Vehicles::SoundFlags::flag1) != Vehicles::SoundFlags::none;
+            if (lhsDeferred != rhsDeferred)
+            {
+                return rhsDeferred;
+            }
+            if (lhs.volume != rhs.volume)
+            {
+                return lhs.volume > rhs.volume;
+            }
+            return lhs.vehicle->id < rhs.vehicle->id;
+        };
+        std::partial_sort(std::begin(_vehicleSoundCandidates), std::begin(_vehicleSoundCandidates) + budget, std::end(_vehicleSoundCandidates), isLouder);
 
-        for (auto* v : VehicleManager::VehicleList())
+        for (size_t i = 0; i < budget; ++i)
         {
-            Vehicles::Vehicle train(*v);
-            processVehicleForSound(*train.veh2, train.veh2->sound, step);
-            processVehicleForSound(*train.tail, train.tail->sound, step);
+            auto& candidate = _vehicleSoundCandidates[i];
+            candidate.sound->soundFlags |= Vehicles::SoundFlags::flag0;
+            _flaggedVehicleSounds.push_back(candidate.vehicle->id);
         }
+        _numActiveVehicleSounds = static_cast<uint8_t>(budget);
     }
 
     // 0x48A73B
@@ -823,14 +946,20 @@ namespace OpenLoco::Audio
         {
             if (!_audioIsPaused && _audioIsEnabled)
             {
-                processVehicleSounds(0);
-                processVehicleSounds(1);
-                processVehicleSounds(2);
+                processVehicleSounds();
                 for (auto& vc : _vehicleChannels)
                 {
                     vc.update();
                 }
-                processVehicleSounds(3);
+                // 0x0048A4BF
+                for (auto id : _flaggedVehicleSounds)
+                {
+                    auto* v = EntityManager::get<Vehicles::VehicleBase>(id);
+                    if (v != nullptr && v->hasSoundPlayer())
+                    {
+                        playSound(id, *v->getVehicleSound());
+                    }
+                }
             }
         }
     }
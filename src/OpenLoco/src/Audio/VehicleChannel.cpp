@@ -88,6 +88,11 @@ namespace OpenLoco::Audio
         return { makeObjectSoundId(soundParams.drivingSoundId), { volume, panX, soundParams.drivingSoundFrequency } };
     }
 
+    int32_t getVehicleSoundVolume(const Vehicles::VehicleBase& base, const Vehicles::VehicleSound& soundParams)
+    {
+        return getChannelAttributesFromVehicle(base, soundParams).second.volume;
+    }
+
     void VehicleChannel::begin(EntityId vid)
     {
         auto v = EntityManager::get<Vehicles::VehicleBase>(vid);
@@ -2,6 +2,12 @@
 #include "Audio.h"
 #include "Channel.h"
 
+namespace OpenLoco::Vehicles
+{
+    struct VehicleBase;
+    struct VehicleSound;
+}
+
 namespace OpenLoco::Audio
 {
     class VehicleChannel
@@ -24,4 +30,7 @@ namespace OpenLoco::Audio
         void update();
         void stop();
     };
+
+    // Volume (in hundredth decibels) the vehicle sound would be played at from its sound window
+    int32_t getVehicleSoundVolume(const Vehicles::VehicleBase& base, const Vehicles::VehicleSound& soundParams);
 }
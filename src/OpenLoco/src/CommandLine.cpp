@@ -1,14 +1,34 @@
 #include "CommandLine.h"
+#include "Config.h"
+#include "Date.h"
+#include "Entities/EntityManager.h"
+#include "Environment.h"
 #include "GameSaveCompare.h"
 #include "GameState.h"
+#include "Graphics/Colour.h"
+#include "Graphics/Gfx.h"
+#include "Graphics/ImageId.h"
+#include "Graphics/RenderTarget.h"
+#include "Graphics/SoftwareDrawingContext.h"
+#include "Map/TileManager.h"
 #include "OpenLoco.h"
+#include "Paint/Paint.h"
 #include "S5/S5.h"
 #include "S5/SawyerStream.h"
+#include "Ui/Screenshot.h"
+#include "Viewport.hpp"
+#include "World/Company.h"
+#include "World/CompanyAi/CompanyAi.h"
+#include "World/CompanyManager.h"
+#include "World/StationManager.h"
+#include "World/TownManager.h"
 #include <OpenLoco/Core/MemoryStream.h>
 #include <OpenLoco/Diagnostics/Logging.h>
 #include <OpenLoco/Version.hpp>
+#include <algorithm>
 #include <chrono>
 #include <fmt/chrono.h>
+#include <fstream>
 #include <iostream>
 #include <optional>
 #include <stdlib.h>
@@ -24,6 +44,10 @@ namespace OpenLoco
     static int uncompressFile(const CommandLineOptions& options);
     static int simulate(const CommandLineOptions& options);
     static int compare(const CommandLineOptions& options);
+    static int benchmarkAi(const CommandLineOptions& options);
+    static int benchmarkSprites(const CommandLineOptions& options);
+    static int checkPaintSort(const CommandLineOptions& options);
+    static int renderViewport(const CommandLineOptions& options);
 
     const CommandLineOptions& getCommandLineOptions()
     {
@@ -356,6 +380,33 @@ namespace OpenLoco
                 options.ticks = parser.getArg<int32_t>(2);
                 options.path2 = parser.getArg(3);
             }
+            else if (firstArg == "aibench")
+            {
+                options.action = CommandLineAction::aibench;
+                options.path = parser.getArg(1);
+                options.years = parser.getArg<int32_t>(2);
+                options.competitors = parser.getArg<int32_t>(3);
+            }
+            else if (firstArg == "spritebench")
+            {
+                options.action = CommandLineAction::spritebench;
+                options.iterations = parser.getArg<int32_t>(1);
+            }
+            else if (firstArg == "paintsortcheck")
+            {
+                options.action = CommandLineAction::paintsortcheck;
+                options.path = parser.getArg(1);
+            }
+            else if (firstArg == "render")
+            {
+                options.action = CommandLineAction::render;
+                options.path = parser.getArg(1);
+                options.tileX = parser.getArg<int32_t>(2);
+                options.tileY = parser.getArg<int32_t>(3);
+                options.rotation = parser.getArg<int32_t>(4);
+                options.zoom = parser.getArg<int32_t>(5);
+                options.iterations = parser.getArg<int32_t>(6);
+            }
             else if (firstArg == "compare")
             {
                 options.action = CommandLineAction::compare;
@@ -416,6 +467,10 @@ namespace OpenLoco
         std::cout << "                uncompress [options] <path>" << std::endl;
         std::cout << "                simulate [options] <path> <ticks> [path]" << std::endl;
         std::cout << "                compare [options] <path1> <path2>" << std::endl;
+        std::cout << "                aibench [options] <path> <years> [competitors]" << std::endl;
+        std::cout << "                spritebench [options] [iterations]" << std::endl;
+        std::cout << "                paintsortcheck [options] <path>" << std::endl;
+        std::cout << "                render [options] <path> <x> <y> [rotation] [zoom] [iterations]" << std::endl;
         std::cout << std::endl;
         std::cout << "options:" << std::endl;
         std::cout << "--bind                     Address to bind to when hosting a server" << std::endl;
@@ -449,6 +504,14 @@ namespace OpenLoco
                 return simulate(options);
             case CommandLineAction::compare:
                 return compare(options);
+            case CommandLineAction::aibench:
+                return benchmarkAi(options);
+            case CommandLineAction::spritebench:
+                return benchmarkSprites(options);
+            case CommandLineAction::paintsortcheck:
+                return checkPaintSort(options);
+            case CommandLineAction::render:
+                return renderViewport(options);
             default:
                 return std::nullopt;
         }
@@ -639,4 +702,428 @@ namespace OpenLoco
 
         return result;
     }
+
+    static int benchmarkAi(const CommandLineOptions& options)
+    {
+        setCommandLineOptions(options);
+
+        if (!options.years || *options.years <= 0)
+        {
+            Logging::error("Number of years to simulate not specified");
+            return EXIT_FAILURE;
+        }
+        const auto competitors = std::clamp<int32_t>(options.competitors.value_or(Limits::kMaxCompanies - 1), 0, Limits::kMaxCompanies - 1);
+
+        auto inPath = fs::u8path(options.path);
+        auto outPath = fs::u8path(options.outputPath);
+
+        uint16_t startYear = 0;
+        const auto onLoaded = [&startYear, competitors]() {
+            // Let produceCompanies start every competitor straight away
+            CompanyManager::setMaxCompetingCompanies(competitors);
+            CompanyManager::setCompetitorStartDelay(0);
+            resetAiThinkStats();
+            setAiThinkStatsEnabled(true);
+            startYear = getCurrentYear();
+        };
+        const auto shouldTick = [&startYear, &options]() {
+            return getCurrentYear() < startYear + *options.years;
+        };
+
+        const auto timeStarted = std::chrono::high_resolution_clock::now();
+
+        try
+        {
+            OpenLoco::simulateGame(inPath, onLoaded, shouldTick);
+        }
+        catch (...)
+        {
+            Logging::error("Unable to load and simulate {}", inPath.u8string());
+            return EXIT_FAILURE;
+        }
+
+        const auto timeElapsed = std::chrono::high_resolution_clock::now() - timeStarted;
+        setAiThinkStatsEnabled(false);
+
+        auto& gameState = getGameState();
+        Logging::info("--------------------------------");
+        Logging::info("- AI benchmark");
+        Logging::info("--------------------------------");
+        Logging::info("Input:");
+        Logging::info("  path:        {}", inPath.u8string());
+        Logging::info("  years:       {} ({} - {})", *options.years, startYear, getCurrentYear());
+        Logging::info("  competitors: {}", competitors);
+        Logging::info("Companies:");
+        for (auto& company : CompanyManager::companies())
+        {
+            if (CompanyManager::isPlayerCompany(company.id()))
+            {
+                continue;
+            }
+
+            const auto& stats = getAiThinkStats(company.id());
+            const auto numRoutes = std::count_if(std::begin(company.aiThoughts), std::end(company.aiThoughts), [](const auto& thought) {
+                return thought.type != AiThoughtType::null;
+            });
+            const auto totalMs = std::chrono::duration<double, std::milli>(stats.duration).count();
+            const auto averageUs = stats.numThinks != 0 ? std::chrono::duration<double, std::micro>(stats.duration).count() / stats.numThinks : 0.0;
+
+            Logging::info("  company {}:", enumValue(company.id()));
+            Logging::info("    thinks:        {}", stats.numThinks);
+            Logging::info("    think time:    {:.2f} ms total, {:.2f} us average", totalMs, averageUs);
+            Logging::info("    game commands: {}", stats.numGameCommands);
+            Logging::info("    cash:          {}", company.cash.asInt64());
+            Logging::info("    routes:        {}", numRoutes);
+        }
+        Logging::info("Output:");
+        Logging::info("  scenario ticks: {}", gameState.scenarioTicks);
+        Logging::info("Duration: {:%S} sec", timeElapsed);
+
+        if (!outPath.empty())
+        {
+            try
+            {
+                S5::exportGameStateToFile(outPath, S5::SaveFlags::none);
+                Logging::info("  path:           {}", outPath.u8string());
+            }
+            catch (...)
+            {
+                Logging::error("Unable to save game to {}", outPath.u8string());
+                return EXIT_FAILURE;
+            }
+        }
+
+        return EXIT_SUCCESS;
+    }
+
+    // Draws every G1 sprite at every zoom level with the common blend modes
+    static int benchmarkSprites(const CommandLineOptions& options)
+    {
+        setCommandLineOptions(options);
+
+        const auto iterations = std::max(options.iterations.value_or(10), 1);
+
+        Config::read();
+        if (options.locomotionDataPath.has_value())
+        {
+            Config::get().locoInstallPath = options.locomotionDataPath.value();
+        }
+        Environment::resolvePaths();
+
+        try
+        {
+            Gfx::loadG1();
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to load g1: {}", e.what());
+            return EXIT_FAILURE;
+        }
+
+        struct BlendMode
+        {
+            std::string_view name;
+            ImageId (*getImage)(uint32_t index);
+        };
+        static constexpr std::array<BlendMode, 3> kBlendModes = {
+            BlendMode{ "copy", [](uint32_t index) { return ImageId(index); } },
+            BlendMode{ "remap", [](uint32_t index) { return ImageId(index, Colour::mutedDarkRed); } },
+            BlendMode{ "glass", [](uint32_t index) { return ImageId(index).withTranslucency(ExtColour::unk2E); } },
+        };
+
+        uint32_t numSprites = 0;
+        for (uint32_t index = 0; index < Gfx::G1ExpectedCount::kDisc; ++index)
+        {
+            const auto* element = Gfx::getG1Element(index);
+            if (element != nullptr && element->width > 0 && element->height > 0)
+            {
+                numSprites++;
+            }
+        }
+
+        Logging::info("--------------------------------");
+        Logging::info("- Sprite benchmark");
+        Logging::info("--------------------------------");
+        Logging::info("  sprites:    {}", numSprites);
+        Logging::info("  iterations: {}", iterations);
+
+        // Sprites are drawn centred on a fixed size buffer whatever the zoom level
+        constexpr int16_t kBufferSize = 512;
+        std::vector<uint8_t> buffer(kBufferSize * kBufferSize);
+        Gfx::SoftwareDrawingContext drawingCtx;
+
+        for (uint8_t zoomLevel = 0; zoomLevel < 4; ++zoomLevel)
+        {
+            const int16_t size = kBufferSize << zoomLevel;
+            Gfx::RenderTarget rt{};
+            rt.bits = buffer.data();
+            rt.x = -size / 2;
+            rt.y = -size / 2;
+            rt.width = size;
+            rt.height = size;
+            rt.pitch = 0;
+            rt.zoomLevel = zoomLevel;
+            drawingCtx.pushRenderTarget(rt);
+
+            for (const auto& mode : kBlendModes)
+            {
+                const auto timeStarted = std::chrono::high_resolution_clock::now();
+                for (auto i = 0; i < iterations; ++i)
+                {
+                    for (uint32_t index = 0; index < Gfx::G1ExpectedCount::kDisc; ++index)
+                    {
+                        drawingCtx.drawImage({ 0, 0 }, mode.getImage(index));
+                    }
+                }
+                const auto timeElapsed = std::chrono::high_resolution_clock::now() - timeStarted;
+                const auto totalMs = std::chrono::duration<double, std::milli>(timeElapsed).count();
+                Logging::info("  zoom {} {:<6} {:>10.3f} ms per pass", zoomLevel, mode.name, totalMs / iterations);
+            }
+
+            drawingCtx.popRenderTarget();
+        }
+
+        return EXIT_SUCCESS;
+    }
+
+    // Paints the whole map of a saved game with both arrangeStructs and arrangeStructsReference at
+    // every zoom level and rotation and compares the images, any difference is a sorting regression.
+    static int checkPaintSort(const CommandLineOptions& options)
+    {
+        setCommandLineOptions(options);
+
+        if (options.path.empty())
+        {
+            Logging::error("No file specified.");
+            return EXIT_FAILURE;
+        }
+
+        auto inPath = fs::u8path(options.path);
+        try
+        {
+            OpenLoco::simulateGame(inPath, []() {}, []() { return false; });
+        }
+        catch (...)
+        {
+            Logging::error("Unable to load {}", inPath.u8string());
+            return EXIT_FAILURE;
+        }
+
+        Logging::info("--------------------------------");
+        Logging::info("- Paint sort check");
+        Logging::info("--------------------------------");
+        Logging::info("  path: {}", inPath.u8string());
+
+        // Painted in columns like Viewport::paint, starting above the map to include tall scenery on high ground
+        constexpr int16_t kColumnWidth = 32;
+        constexpr int16_t kColumnHeight = 1024;
+        constexpr int16_t kTop = -2048;
+
+        using Duration = std::chrono::high_resolution_clock::duration;
+        uint32_t numDifferences = 0;
+        for (uint8_t zoomLevel = 0; zoomLevel < 4; ++zoomLevel)
+        {
+            const auto bufferSize = static_cast<size_t>(kColumnWidth >> zoomLevel) * (kColumnHeight >> zoomLevel);
+            std::vector<uint8_t> referenceBuffer(bufferSize);
+            std::vector<uint8_t> buffer(bufferSize);
+
+            for (uint8_t rotation = 0; rotation < 4; ++rotation)
+            {
+                Paint::SessionOptions sessionOptions{};
+                sessionOptions.rotation = rotation;
+                sessionOptions.viewFlags = Ui::ViewportFlags::none;
+
+                Duration referenceTime{};
+                Duration sortTime{};
+                uint32_t numColumns = 0;
+                uint32_t numColumnDifferences = 0;
+                for (int16_t y = kTop; y < World::kMapHeight; y += kColumnHeight)
+                {
+                    for (int16_t x = -World::kMapWidth; x < World::kMapWidth; x += kColumnWidth)
+                    {
+                        Gfx::RenderTarget rt{};
+                        rt.x = x;
+                        rt.y = y;
+                        rt.width = kColumnWidth;
+                        rt.height = kColumnHeight;
+                        rt.pitch = 0;
+                        rt.zoomLevel = zoomLevel;
+
+                        const auto paintColumn = [&rt, &sessionOptions](std::vector<uint8_t>& bits, bool useReference) {
+                            std::fill(bits.begin(), bits.end(), 0);
+                            rt.bits = bits.data();
+
+                            Gfx::SoftwareDrawingContext drawingCtx;
+                            drawingCtx.pushRenderTarget(rt);
+                            auto session = Paint::PaintSession(rt, sessionOptions);
+                            session.generate();
+
+                            const auto timeStarted = std::chrono::high_resolution_clock::now();
+                            if (useReference)
+                            {
+                                session.arrangeStructsReference();
+                            }
+                            else
+                            {
+                                session.arrangeStructs();
+                            }
+                            const auto timeElapsed = std::chrono::high_resolution_clock::now() - timeStarted;
+
+                            session.drawStructs(drawingCtx);
+                            drawingCtx.popRenderTarget();
+                            return timeElapsed;
+                        };
+
+                        referenceTime += paintColumn(referenceBuffer, true);
+                        sortTime += paintColumn(buffer, false);
+                        numColumns++;
+                        if (buffer != referenceBuffer)
+                        {
+                            numColumnDifferences++;
+                        }
+                    }
+                }
+
+                const auto referenceMs = std::chrono::duration<double, std::milli>(referenceTime).count();
+                const auto sortMs = std::chrono::duration<double, std::milli>(sortTime).count();
+                Logging::info("  zoom {} rotation {}: {} of {} columns differ, sort {:.3f} ms, reference {:.3f} ms", zoomLevel, rotation, numColumnDifferences, numColumns, sortMs, referenceMs);
+                numDifferences += numColumnDifferences;
+            }
+        }
+
+        if (numDifferences != 0)
+        {
+            Logging::error("Sorted images differ from the reference in {} columns", numDifferences);
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+
+    // Renders a viewport centred on a tile of a saved game without a window, writing it to a png
+    // when an output path is given. Rendering is repeated to measure the time taken by each phase.
+    static int renderViewport(const CommandLineOptions& options)
+    {
+        setCommandLineOptions(options);
+
+        if (options.path.empty())
+        {
+            Logging::error("No file specified.");
+            return EXIT_FAILURE;
+        }
+        if (!options.tileX || !options.tileY)
+        {
+            Logging::error("Tile position to centre on not specified");
+            return EXIT_FAILURE;
+        }
+        const auto tilePos = World::TilePos2(*options.tileX, *options.tileY);
+        if (!World::validCoords(tilePos))
+        {
+            Logging::error("Tile position {}, {} is outside of the map", tilePos.x, tilePos.y);
+            return EXIT_FAILURE;
+        }
+        const auto rotation = static_cast<uint8_t>(options.rotation.value_or(0) & 3);
+        const auto zoomLevel = static_cast<uint8_t>(std::clamp(options.zoom.value_or(0), 0, 3));
+        const auto iterations = std::max(options.iterations.value_or(1), 1);
+
+        auto inPath = fs::u8path(options.path);
+        auto outPath = fs::u8path(options.outputPath);
+        try
+        {
+            OpenLoco::simulateGame(inPath, []() {}, []() { return false; });
+        }
+        catch (...)
+        {
+            Logging::error("Unable to load {}", inPath.u8string());
+            return EXIT_FAILURE;
+        }
+
+        constexpr int16_t kWidth = 1920;
+        constexpr int16_t kHeight = 1080;
+
+        Ui::Viewport viewport{};
+        viewport.width = kWidth;
+        viewport.height = kHeight;
+        viewport.x = 0;
+        viewport.y = 0;
+        viewport.viewWidth = kWidth << zoomLevel;
+        viewport.viewHeight = kHeight << zoomLevel;
+        viewport.zoom = zoomLevel;
+        viewport.flags = Ui::ViewportFlags::none;
+        viewport.setRotation(rotation);
+        TownManager::updateLabels();
+        StationManager::updateLabels();
+
+        // Ensure sprites appear regardless of rotation
+        EntityManager::resetSpatialIndex();
+
+        const auto centre = World::toWorldSpace(tilePos) + World::Pos2{ World::kTileSize / 2, World::kTileSize / 2 };
+        const auto z = World::TileManager::getHeight(centre).landHeight;
+        const auto viewPos = viewport.centre2dCoordinates({ centre.x, centre.y, z });
+        viewport.viewX = viewPos.x;
+        viewport.viewY = viewPos.y;
+
+        std::vector<uint8_t> bits(static_cast<size_t>(kWidth) * kHeight);
+        Gfx::RenderTarget rt{};
+        rt.bits = bits.data();
+        rt.x = 0;
+        rt.y = 0;
+        rt.width = kWidth;
+        rt.height = kHeight;
+        rt.pitch = 0;
+        rt.zoomLevel = 0;
+
+        Gfx::SoftwareDrawingContext drawingCtx;
+        drawingCtx.pushRenderTarget(rt);
+
+        Ui::resetViewportPaintStats();
+        Ui::setViewportPaintStatsEnabled(true);
+        const auto timeStarted = std::chrono::high_resolution_clock::now();
+        for (auto i = 0; i < iterations; ++i)
+        {
+            viewport.render(drawingCtx);
+        }
+        const auto timeElapsed = std::chrono::high_resolution_clock::now() - timeStarted;
+        Ui::setViewportPaintStatsEnabled(false);
+
+        drawingCtx.popRenderTarget();
+
+        const auto stats = Ui::getViewportPaintStats();
+        const auto toMs = [iterations](auto duration) {
+            return std::chrono::duration<double, std::milli>(duration).count() / iterations;
+        };
+        Logging::info("--------------------------------");
+        Logging::info("- Render");
+        Logging::info("--------------------------------");
+        Logging::info("Input:");
+        Logging::info("  path:       {}", inPath.u8string());
+        Logging::info("  tile:       {}, {}", tilePos.x, tilePos.y);
+        Logging::info("  rotation:   {}", rotation);
+        Logging::info("  zoom:       {}", zoomLevel);
+        Logging::info("  size:       {}x{}", kWidth, kHeight);
+        Logging::info("  iterations: {}", iterations);
+        Logging::info("Per iteration:");
+        Logging::info("  columns:    {}", stats.numColumns / iterations);
+        Logging::info("  generate:   {:.3f} ms", toMs(stats.generate));
+        Logging::info("  arrange:    {:.3f} ms", toMs(stats.arrange));
+        Logging::info("  draw:       {:.3f} ms", toMs(stats.draw));
+        Logging::info("  total:      {:.3f} ms", toMs(timeElapsed));
+
+        if (!outPath.empty())
+        {
+            try
+            {
+                std::fstream outputStream(outPath, std::ios::out | std::ios::binary);
+                Ui::saveRenderTargetToPng(rt, outputStream);
+                Logging::info("Output:");
+                Logging::info("  path:       {}", outPath.u8string());
+            }
+            catch (...)
+            {
+                Logging::error("Unable to save image to {}", outPath.u8string());
+                return EXIT_FAILURE;
+            }
+        }
+
+        return EXIT_SUCCESS;
+    }
 }
@@ -15,6 +15,10 @@ namespace OpenLoco
         uncompress,
         simulate,
         compare,
+        aibench,
+        spritebench,
+        paintsortcheck,
+        render,
         help,
         version,
         intro,
@@ -27,6 +31,13 @@ namespace OpenLoco
         std::string path;
         std::string path2;
         std::optional<int32_t> ticks;
+        std::optional<int32_t> years;
+        std::optional<int32_t> competitors;
+        std::optional<int32_t> iterations;
+        std::optional<int32_t> tileX;
+        std::optional<int32_t> tileY;
+        std::optional<int32_t> rotation;
+        std::optional<int32_t> zoom;
         std::string outputPath;
         std::string bind;
         std::optional<uint16_t> port{};
@@ -13,6 +13,7 @@
 #include "Objects/LandObject.h"
 #include "Objects/ObjectManager.h"
 #include "Scenario/ScenarioOptions.h"
+#include "World/AirportMovementGraph.h"
 #include "World/CompanyManager.h"
 #include "World/Industry.h"
 #include "World/StationManager.h"
@@ -441,6 +442,7 @@ namespace OpenLoco::GameCommands
             station->airportStartPos = args.pos;
             station->airportRotation = args.rotation;
             station->airportMovementOccupiedEdges = 0;
+            AirportMovementGraph::invalidate(returnState.lastPlacedAirport);
             station->invalidate();
             recalculateStationModes(returnState.lastPlacedAirport);
             recalculateStationCenter(returnState.lastPlacedAirport);
@@ -12,6 +12,7 @@
 #include "Vehicles/VehicleHead.h"
 #include "Vehicles/VehicleManager.h"
 #include "ViewportManager.h"
+#include "World/AirportMovementGraph.h"
 #include "World/Industry.h"
 #include "World/Station.h"
 #include "World/StationManager.h"
@@ -169,6 +170,9 @@ namespace OpenLoco::GameCommands
         {
             auto* station = StationManager::get(stationId);
 
+            AirportMovementGraph::invalidate(stationId);
+            const auto [minPos, maxPos] = airportObj->getAirportExtents(World::toTileSpace(pos), rotation);
+            StationManager::invalidateCatchmentCoverage(minPos, maxPos);
             removeTileFromStationAndRecalcCargo(stationId, pos, rotation);
             station->flags &= ~StationFlags::flag_6;
             station->invalidate();
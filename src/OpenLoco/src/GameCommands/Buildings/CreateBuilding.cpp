@@ -247,6 +247,7 @@ namespace OpenLoco::GameCommands
                 elBuilding->setVariation(args.variation);
                 elBuilding->setAge(0);
                 elBuilding->setIsMiscBuilding(buildingObj->hasFlags(BuildingObjectFlags::miscBuilding));
+                invalidateCargoAcceptance(tilePos);
 
                 bool hasFrames = false;
                 const auto partAnimations = buildingObj->getBuildingPartAnimations();
@@ -333,6 +333,7 @@ namespace OpenLoco::GameCommands
                     elStation->setAiAllocated(false);
                     World::TileManager::mapInvalidateTileFull(trackLoc);
                     const auto stationId = elStation->stationId();
+                    StationManager::addCatchmentCoverage(stationId, World::toTileSpace(trackLoc), World::toTileSpace(trackLoc));
                     getLegacyReturnState().lastPlacedTrackRoadStationId = stationId;
                     auto* station = StationManager::get(stationId);
                     if ((station->flags & StationFlags::flag_5) != StationFlags::none)
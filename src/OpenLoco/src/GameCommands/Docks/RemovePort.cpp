@@ -118,6 +118,9 @@ namespace OpenLoco::GameCommands
         {
             auto* station = StationManager::get(stationId);
 
+            // Docks are always size 2x2
+            const auto portTilePos = World::toTileSpace(args.pos);
+            StationManager::invalidateCatchmentCoverage(portTilePos, portTilePos + World::TilePos2(1, 1));
             removeTileFromStationAndRecalcCargo(stationId, args.pos, rotation);
             station->invalidate();
 
@@ -104,6 +104,7 @@ namespace OpenLoco::GameCommands
 {
     static uint16_t _gameCommandFlags;
     static uint8_t _gameCommandNestLevel = 0; // 0x00508F08
+    static uint32_t _numCommandsIssued = 0;
 
     static CompanyId _updatingCompanyId;                                                      // 0x009C68EB
     static const World::TileElement* _errorTileElementPtr = World::TileManager::kInvalidTile; // 0x009C68D0
@@ -247,6 +248,8 @@ namespace OpenLoco::GameCommands
             return loc_4313C6(esi, regs);
         }
 
+        _numCommandsIssued++;
+
         if ((flags & Flags::apply) == 0)
         {
             return loc_4313C6(esi, regs);
@@ -583,6 +586,11 @@ namespace OpenLoco::GameCommands
         _gGameCommandExpenditureType = type;
     }
 
+    uint32_t getNumCommandsIssued()
+    {
+        return _numCommandsIssued;
+    }
+
     CompanyId getUpdatingCompanyId()
     {
         return _updatingCompanyId;
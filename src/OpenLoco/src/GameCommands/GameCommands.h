@@ -270,6 +270,8 @@ namespace OpenLoco::GameCommands
     void setUpdatingCompanyId(CompanyId companyId);
     uint8_t getCommandNestLevel();
     void resetCommandNestLevel();
+    // Number of top level commands (queries and applies) issued through doCommand since startup
+    uint32_t getNumCommandsIssued();
 
     // TODO: rework these
     struct LegacyReturnState
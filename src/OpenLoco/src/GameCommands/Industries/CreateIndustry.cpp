@@ -26,6 +26,7 @@
 #include "SceneManager.h"
 #include "ViewportManager.h"
 #include "World/IndustryManager.h"
+#include "World/Station.h"
 #include "World/TownManager.h"
 #include <OpenLoco/Core/Numerics.hpp>
 
@@ -343,6 +344,7 @@ namespace OpenLoco::GameCommands
                 elIndustry->setSectionProgress(0);
                 elIndustry->setColour(colour);
                 elIndustry->setBuildingType(buildingType);
+                invalidateCargoAcceptance(tilePos);
                 elIndustry->setVar_6_003F(0);
                 World::AnimationManager::createAnimation(3, World::toWorldSpace(tilePos), elIndustry->baseZ());
                 elIndustry->setGhost(flags & Flags::ghost);
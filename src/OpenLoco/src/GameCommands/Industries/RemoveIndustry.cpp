@@ -14,6 +14,7 @@
 #include "ViewportManager.h"
 #include "World/Industry.h"
 #include "World/IndustryManager.h"
+#include "World/Station.h"
 #include "World/StationManager.h"
 
 namespace OpenLoco::GameCommands
@@ -23,6 +24,7 @@ namespace OpenLoco::GameCommands
     static void removeElement(const World::Pos2& pos, World::TileElement& el)
     {
         Ui::ViewportManager::invalidate(pos, el.baseHeight(), el.clearHeight());
+        invalidateCargoAcceptance(World::toTileSpace(pos));
         World::TileManager::removeElement(el);
     }
 
@@ -23,6 +23,7 @@
 #include "SceneManager.h"
 #include "World/CompanyManager.h"
 #include "World/StationManager.h"
+#include "World/Town.h"
 #include <OpenLoco/Core/Numerics.hpp>
 
 namespace OpenLoco::GameCommands
@@ -869,6 +870,7 @@ namespace OpenLoco::GameCommands
             newElRoad->setFlag6(piece.index == (roadPieces.size() - 1));
             newElRoad->setGhost(flags & Flags::ghost);
             newElRoad->setAiAllocated(flags & Flags::aiAllocated);
+            invalidateTownRoadExtents(roadLoc);
             if (shouldInvalidateTile(flags))
             {
                 World::TileManager::mapInvalidateTileFull(roadLoc);
@@ -928,6 +930,7 @@ namespace OpenLoco::GameCommands
                     newElRoad->setFlag6(true);
                     newElRoad->setGhost(flags & Flags::ghost);
                     newElRoad->setAiAllocated(flags & Flags::aiAllocated);
+                    invalidateTownRoadExtents(args.pos);
                 };
 
                 auto requiresAdditionalLeft = [&roadIdUnk, rot0Flag, rot1Flag, rot2Flag, rot3Flag]() {
@@ -15,6 +15,7 @@
 #include "RemoveRoadStation.h"
 #include "Scenario/ScenarioOptions.h"
 #include "SceneManager.h"
+#include "World/Town.h"
 #include "World/TownManager.h"
 
 namespace OpenLoco::GameCommands
@@ -286,6 +287,7 @@ namespace OpenLoco::GameCommands
             }
 
             World::TileManager::removeElement(*reinterpret_cast<World::TileElement*>(roadElPiece));
+            invalidateTownRoadExtents(roadLoc);
             Scenario::getOptions().madeAnyChanges = 1;
             World::TileManager::setLevelCrossingFlags(roadLoc);
         }
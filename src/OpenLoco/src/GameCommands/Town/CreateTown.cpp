@@ -147,6 +147,7 @@ namespace OpenLoco::GameCommands
         {
             StringManager::emptyUserString(newTown->name);
             newTown->name = StringIds::null;
+            TownManager::invalidateTownGrid();
             return 0;
         }
 
@@ -139,6 +139,7 @@ namespace OpenLoco::GameCommands
 
         StringManager::emptyUserString(town->name);
         town->name = StringIds::null;
+        TownManager::invalidateTownGrid();
 
         Ui::Windows::TownList::removeTown(args.townId);
 
@@ -157,7 +158,7 @@ namespace OpenLoco::GameCommands
         auto tileHeight = TileManager::getHeight(oldTownCentre);
         setPosition({ oldTownCentre.x, oldTownCentre.y, tileHeight.landHeight });
 
-        TownManager::resetBuildingsInfluence();
+        TownManager::reassignBuildingsInfluence(args.townId);
 
         auto& options = Scenario::getOptions();
         options.madeAnyChanges = 1;
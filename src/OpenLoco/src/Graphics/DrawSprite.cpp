@@ -3,6 +3,7 @@
 #include "DrawSpriteRLE.hpp"
 #include "Graphics/Gfx.h"
 #include "Graphics/RenderTarget.h"
+#include "ZoomedSpriteCache.h"
 
 namespace OpenLoco::Gfx
 {
@@ -51,9 +52,67 @@ namespace OpenLoco::Gfx
 #pragma warning(disable : 4063) // not a valid value for a switch of this enum
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wswitch" // not a valid value for a switch of this enum
+    template<uint8_t TZoomLevel, bool TIsRLE>
+    inline void drawSpriteToBufferHelper(const RenderTarget& rt, const DrawSpriteArgs& args, const DrawBlendOp op);
+
+    // Zoomed out RLE images are drawn from a cached copy holding only the sampled pixels, which
+    // is drawn at zoom level 0 into the (already downscaled) render target.
+    // Returns false if no cached copy could be made.
+    template<uint8_t TZoomLevel>
+    static bool drawZoomedRLESprite(const RenderTarget& rt, const DrawSpriteArgs& args, const DrawBlendOp op)
+    {
+        constexpr int32_t zoom = 1 << TZoomLevel;
+        auto srcY = args.srcPos.y;
+        auto height = args.size.height;
+        auto dstY = args.dstPos.y;
+        // Matches the adjustment of drawRLESprite
+        if (srcY < 0)
+        {
+            srcY += zoom;
+            height -= zoom;
+            dstY++;
+        }
+        if (height <= 0)
+        {
+            return true;
+        }
+
+        const auto srcX = args.srcPos.x;
+        const auto* zoomedElement = ZoomedSpriteCache::get(args.sourceImage, TZoomLevel, srcX & (zoom - 1), srcY & (zoom - 1));
+        if (zoomedElement == nullptr)
+        {
+            return false;
+        }
+
+        auto zoomedRt = rt;
+        zoomedRt.width = rt.width >> TZoomLevel;
+        zoomedRt.height = rt.height >> TZoomLevel;
+        zoomedRt.zoomLevel = 0;
+
+        // srcX can be slightly negative when the render target is not aligned to the zoom, the
+        // arithmetic shift keeps the sampled columns in place.
+        const DrawSpriteArgs zoomedArgs{
+            args.palMap,
+            *zoomedElement,
+            Ui::Point{ srcX >> TZoomLevel, srcY >> TZoomLevel },
+            Ui::Point{ args.dstPos.x, dstY },
+            Ui::Size((args.size.width + zoom - 1) >> TZoomLevel, (height + zoom - 1) >> TZoomLevel),
+            args.noiseImage
+        };
+        drawSpriteToBufferHelper<0, true>(zoomedRt, zoomedArgs, op);
+        return true;
+    }
+
     template<uint8_t TZoomLevel, bool TIsRLE>
     inline void drawSpriteToBufferHelper(const RenderTarget& rt, const DrawSpriteArgs& args, const DrawBlendOp op)
     {
+        if constexpr (TIsRLE && TZoomLevel > 0)
+        {
+            if (drawZoomedRLESprite<TZoomLevel>(rt, args, op))
+            {
+                return;
+            }
+        }
         if constexpr (!TIsRLE)
         {
             switch (op)
@@ -39,6 +39,15 @@ namespace OpenLoco::Gfx
                 noiseMask = nextNoiseMask;
             }
         }
+        else if constexpr (TZoomLevel == 0)
+        {
+            for (; height > 0; height--)
+            {
+                blitSpan<TBlendOp>(src, dst, width, paletteMap);
+                src += srcLineWidth;
+                dst += dstLineWidth;
+            }
+        }
         else
         {
             for (; height > 0; height -= zoom)
@@ -2,6 +2,12 @@
 #include "DrawSprite.h"
 #include "Graphics/Gfx.h"
 #include "Graphics/PaletteMap.h"
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OPENLOCO_SPRITE_SSE2
+#include <emmintrin.h>
+#endif
 
 namespace OpenLoco::Gfx
 {
@@ -82,4 +88,81 @@ namespace OpenLoco::Gfx
             return true;
         }
     }
+
+    // The pixel blitPixel would write ignoring transparency
+    template<DrawBlendOp TBlendOp>
+    uint8_t mapPixel(uint8_t src, uint8_t dst, [[maybe_unused]] const PaletteMap::View paletteMap)
+    {
+        if constexpr (((TBlendOp & DrawBlendOp::src) != DrawBlendOp::none) && ((TBlendOp & DrawBlendOp::dst) != DrawBlendOp::none))
+        {
+            // There is no blend row for transparent pixels, they are never written anyway
+            return src != PaletteIndex::transparent ? blend(paletteMap, src, dst) : PaletteIndex::transparent;
+        }
+        else if constexpr ((TBlendOp & DrawBlendOp::src) != DrawBlendOp::none)
+        {
+            return paletteMap[src];
+        }
+        else if constexpr ((TBlendOp & DrawBlendOp::dst) != DrawBlendOp::none)
+        {
+            return paletteMap[dst];
+        }
+        else
+        {
+            return src;
+        }
+    }
+
+    // Blits a contiguous run of pixels, only valid at zoom level 0 where every source pixel is used.
+    // Sixteen pixels are done at a time: the palette lookups first and then the transparency
+    // of all of them is applied at once rather than branching on each pixel.
+    template<DrawBlendOp TBlendOp>
+    void blitSpan(const uint8_t* src, uint8_t* dst, const int32_t numPixels, const PaletteMap::View paletteMap)
+    {
+        static_assert((TBlendOp & DrawBlendOp::noiseMask) == DrawBlendOp::none);
+        constexpr bool isTransparent = (TBlendOp & DrawBlendOp::transparent) != DrawBlendOp::none;
+        constexpr bool isMapped = (TBlendOp & (DrawBlendOp::src | DrawBlendOp::dst)) != DrawBlendOp::none;
+
+        if constexpr (!isTransparent && !isMapped)
+        {
+            std::copy_n(src, numPixels, dst);
+            return;
+        }
+
+        int32_t i = 0;
+#ifdef OPENLOCO_SPRITE_SSE2
+        const auto transparent = _mm_set1_epi8(static_cast<char>(PaletteIndex::transparent));
+        for (; i + 16 <= numPixels; i += 16)
+        {
+            const auto srcPixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            const auto dstPixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+
+            auto newPixels = srcPixels;
+            if constexpr (isMapped)
+            {
+                alignas(16) uint8_t mapped[16];
+                for (auto j = 0; j < 16; ++j)
+                {
+                    mapped[j] = mapPixel<TBlendOp>(src[i + j], dst[i + j], paletteMap);
+                }
+                newPixels = _mm_load_si128(reinterpret_cast<const __m128i*>(mapped));
+            }
+
+            if constexpr (isTransparent)
+            {
+                // Keep the destination where either the source or the mapped pixel is transparent
+                auto keepDst = _mm_cmpeq_epi8(srcPixels, transparent);
+                if constexpr (isMapped)
+                {
+                    keepDst = _mm_or_si128(keepDst, _mm_cmpeq_epi8(newPixels, transparent));
+                }
+                newPixels = _mm_or_si128(_mm_and_si128(keepDst, dstPixels), _mm_andnot_si128(keepDst, newPixels));
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), newPixels);
+        }
+#endif
+        for (; i < numPixels; ++i)
+        {
+            blitPixel<TBlendOp>(src[i], dst[i], paletteMap, 0xFF);
+        }
+    }
 }
@@ -89,6 +89,13 @@ namespace OpenLoco::Gfx
                         std::copy_n(src, numPixels, dst);
                     }
                 }
+                else if constexpr (TZoomLevel == 0)
+                {
+                    if (numPixels > 0)
+                    {
+                        blitSpan<TBlendOp>(src, dst, numPixels, args.palMap);
+                    }
+                }
                 else
                 {
                     auto& paletteMap = args.palMap;
@@ -7,6 +7,7 @@
 #include "Graphics/DrawingContext.h"
 #include "Graphics/RenderTarget.h"
 #include "Graphics/SoftwareDrawingEngine.h"
+#include "Graphics/ZoomedSpriteCache.h"
 #include "ImageIds.h"
 #include "Input.h"
 #include "Localisation/Formatting.h"
@@ -158,6 +159,7 @@ namespace OpenLoco::Gfx
 
         _g1Buffer = std::move(elementData);
         std::copy(elements.begin(), elements.end(), _g1Elements.begin());
+        ZoomedSpriteCache::invalidate();
     }
 
     static int32_t getFontBaseIndex(Font font)
@@ -273,6 +275,7 @@ namespace OpenLoco::Gfx
             {
                 auto& ctx = drawingEngine.getDrawingContext();
                 ctx.clearSingle(PaletteIndex::black0);
+                drawingEngine.invalidatePresent();
             }
 
             drawingEngine.render();
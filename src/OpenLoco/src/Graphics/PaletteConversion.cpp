@@ -0,0 +1,98 @@
+#include "PaletteConversion.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define OPENLOCO_PALETTE_CONVERSION_AVX2
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#if defined(__GNUC__) || defined(__clang__)
+#define OPENLOCO_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define OPENLOCO_TARGET_AVX2
+#endif
+#endif
+
+namespace OpenLoco::Gfx
+{
+    using ConvertRowFunc = void (*)(const uint8_t* src, uint32_t* dst, int32_t width, const PaletteLut& lut);
+
+    static void convertRowScalar(const uint8_t* src, uint32_t* dst, int32_t width, const PaletteLut& lut)
+    {
+        int32_t x = 0;
+        for (; x + 4 <= width; x += 4)
+        {
+            dst[x + 0] = lut[src[x + 0]];
+            dst[x + 1] = lut[src[x + 1]];
+            dst[x + 2] = lut[src[x + 2]];
+            dst[x + 3] = lut[src[x + 3]];
+        }
+        for (; x < width; ++x)
+        {
+            dst[x] = lut[src[x]];
+        }
+    }
+
+#ifdef OPENLOCO_PALETTE_CONVERSION_AVX2
+    OPENLOCO_TARGET_AVX2 static void convertRowAvx2(const uint8_t* src, uint32_t* dst, int32_t width, const PaletteLut& lut)
+    {
+        const auto* lutData = reinterpret_cast<const int*>(lut.data());
+        int32_t x = 0;
+        for (; x + 8 <= width; x += 8)
+        {
+            // Widen 8 indices to 32-bit lanes and look all of them up at once
+            const auto indices = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + x)));
+            const auto pixels = _mm256_i32gather_epi32(lutData, indices, 4);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + x), pixels);
+        }
+        convertRowScalar(src + x, dst + x, width - x, lut);
+    }
+
+    static bool hasAvx2()
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        int info[4]{};
+        __cpuid(info, 0);
+        if (info[0] < 7)
+        {
+            return false;
+        }
+        // AVX and the OS saving the ymm registers are needed as well as AVX2 itself
+        __cpuid(info, 1);
+        constexpr int kOsXSave = 1 << 27;
+        constexpr int kAvx = 1 << 28;
+        if ((info[2] & (kOsXSave | kAvx)) != (kOsXSave | kAvx) || (_xgetbv(0) & 0x6) != 0x6)
+        {
+            return false;
+        }
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#else
+        return __builtin_cpu_supports("avx2");
+#endif
+    }
+#endif
+
+    static ConvertRowFunc selectConvertRow()
+    {
+#ifdef OPENLOCO_PALETTE_CONVERSION_AVX2
+        if (hasAvx2())
+        {
+            return convertRowAvx2;
+        }
+#endif
+        return convertRowScalar;
+    }
+
+    void convertPaletteToPixels(const uint8_t* src, int32_t srcStride, uint8_t* dst, int32_t dstStride, int32_t width, int32_t height, const PaletteLut& lut)
+    {
+        static const ConvertRowFunc convertRow = selectConvertRow();
+
+        for (int32_t y = 0; y < height; ++y)
+        {
+            convertRow(src, reinterpret_cast<uint32_t*>(dst), width, lut);
+            src += srcStride;
+            dst += dstStride;
+        }
+    }
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace OpenLoco::Gfx
+{
+    // Maps each palette index to a pixel in the format of the output texture.
+    using PaletteLut = std::array<uint32_t, 256>;
+
+    // Converts a rectangle of 8-bit palette indices to 32-bit pixels using the lookup table.
+    // Strides are in bytes.
+    void convertPaletteToPixels(const uint8_t* src, int32_t srcStride, uint8_t* dst, int32_t dstStride, int32_t width, int32_t height, const PaletteLut& lut);
+}
@@ -26,6 +26,9 @@ namespace OpenLoco::Gfx
 
     SoftwareDrawingEngine::SoftwareDrawingEngine()
     {
+        // Matches SDL_AllocPalette which starts with every colour white
+        _paletteEntries.fill(PaletteEntry{ 0xFF, 0xFF, 0xFF, 0xFF });
+
         RenderTarget rtDummy{};
         _ctx.pushRenderTarget(rtDummy);
     }
@@ -82,15 +85,6 @@ namespace OpenLoco::Gfx
         const auto scaledHeight = (int32_t)(height / scaleFactor);
 
         // Release old resources.
-        if (_screenSurface != nullptr)
-        {
-            SDL_FreeSurface(_screenSurface);
-        }
-        if (_screenRGBASurface != nullptr)
-        {
-            SDL_FreeSurface(_screenRGBASurface);
-        }
-
         if (_screenTexture != nullptr)
         {
             SDL_DestroyTexture(_screenTexture);
@@ -109,24 +103,6 @@ namespace OpenLoco::Gfx
             _screenTextureFormat = nullptr;
         }
 
-        // Surfaces.
-        _screenSurface = SDL_CreateRGBSurface(0, scaledWidth, scaledHeight, 8, 0, 0, 0, 0);
-        if (_screenSurface == nullptr)
-        {
-            Logging::error("SDL_CreateRGBSurface (_screenSurface) failed: {}", SDL_GetError());
-            return;
-        }
-
-        _screenRGBASurface = SDL_CreateRGBSurface(0, scaledWidth, scaledHeight, 32, 0, 0, 0, 0);
-        if (_screenRGBASurface == nullptr)
-        {
-            Logging::error("SDL_CreateRGBSurface (_screenRGBASurface) failed: {}", SDL_GetError());
-            return;
-        }
-
-        SDL_SetSurfaceBlendMode(_screenRGBASurface, SDL_BLENDMODE_NONE);
-        SDL_SetSurfacePalette(_screenSurface, _palette);
-
         SDL_RendererInfo rendererInfo{};
         int32_t result = SDL_GetRendererInfo(_renderer, &rendererInfo);
         if (result < 0)
@@ -138,13 +114,18 @@ namespace OpenLoco::Gfx
         uint32_t pixelFormat = SDL_PIXELFORMAT_UNKNOWN;
         for (uint32_t i = 0; i < rendererInfo.num_texture_formats; i++)
         {
+            // The palette conversion writes 32-bit pixels
             uint32_t format = rendererInfo.texture_formats[i];
-            if (!SDL_ISPIXELFORMAT_FOURCC(format) && !SDL_ISPIXELFORMAT_INDEXED(format)
-                && (pixelFormat == SDL_PIXELFORMAT_UNKNOWN || SDL_BYTESPERPIXEL(format) < SDL_BYTESPERPIXEL(pixelFormat)))
+            if (!SDL_ISPIXELFORMAT_FOURCC(format) && !SDL_ISPIXELFORMAT_INDEXED(format) && SDL_BYTESPERPIXEL(format) == 4)
             {
                 pixelFormat = format;
+                break;
             }
         }
+        if (pixelFormat == SDL_PIXELFORMAT_UNKNOWN)
+        {
+            pixelFormat = SDL_PIXELFORMAT_ARGB8888;
+        }
 
         SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "nearest");
         _screenTexture = SDL_CreateTexture(_renderer, pixelFormat, SDL_TEXTUREACCESS_STREAMING, scaledWidth, scaledHeight);
@@ -170,8 +151,10 @@ namespace OpenLoco::Gfx
         uint32_t format;
         SDL_QueryTexture(_screenTexture, &format, nullptr, nullptr, nullptr);
         _screenTextureFormat = SDL_AllocFormat(format);
+        updatePaletteLut(0, 256);
 
-        int32_t pitch = _screenSurface->pitch;
+        // Rows are 4 byte aligned
+        int32_t pitch = (scaledWidth + 3) & ~3;
 
         RenderTarget& rt = _screenRT;
         if (rt.bits != nullptr)
@@ -196,6 +179,8 @@ namespace OpenLoco::Gfx
         int16_t blockHeight = 1 << heightShift;
 
         _invalidationGrid.reset(scaledWidth, scaledHeight, blockWidth, blockHeight);
+        _presentGrid.reset(scaledWidth, scaledHeight, blockWidth, blockHeight);
+        _isPresentFullyDirty = true;
 
         // Reset the drawing context, this holds the old screen render target.
         _ctx.reset();
@@ -218,6 +203,12 @@ namespace OpenLoco::Gfx
     void SoftwareDrawingEngine::invalidateRegion(int32_t left, int32_t top, int32_t right, int32_t bottom)
     {
         _invalidationGrid.invalidate(left, top, right, bottom);
+        _presentGrid.invalidate(left, top, right, bottom);
+    }
+
+    void SoftwareDrawingEngine::invalidatePresent()
+    {
+        _isPresentFullyDirty = true;
     }
 
     void SoftwareDrawingEngine::createPalette()
@@ -230,6 +221,9 @@ namespace OpenLoco::Gfx
     {
         assert(index + count < 256);
 
+        std::copy_n(&entries[index], count, &_paletteEntries[index]);
+        updatePaletteLut(index, count);
+
         SDL_Color base[256]{};
         SDL_Color* basePtr = &base[index];
         auto* entryPtr = &entries[index];
@@ -241,11 +235,29 @@ namespace OpenLoco::Gfx
             basePtr->a = 0;
         }
         SDL_SetPaletteColors(_palette, &base[index], index, count);
+
+        // Every pixel has to be converted again with the new colours
+        _isPresentFullyDirty = true;
+    }
+
+    void SoftwareDrawingEngine::updatePaletteLut(int32_t index, int32_t count)
+    {
+        if (_screenTextureFormat == nullptr)
+        {
+            return;
+        }
+        for (auto i = index; i < index + count; ++i)
+        {
+            const auto& entry = _paletteEntries[i];
+            _paletteLut[i] = SDL_MapRGB(_screenTextureFormat, entry.r, entry.g, entry.b);
+        }
     }
 
     // 0x004C5CFA
     void SoftwareDrawingEngine::render()
     {
+        _hasRenderedSincePresent = true;
+
         // Need to first render the current dirty regions before updating the viewports.
         // This is needed to ensure it will copy the correct pixels when the viewport will be moved.
         renderDirtyRegions();
@@ -274,6 +286,7 @@ namespace OpenLoco::Gfx
     {
         auto max = Rect(0, 0, Ui::width(), Ui::height());
         auto rect = _rect.intersection(max);
+        _presentGrid.invalidate(rect.left(), rect.top(), rect.right(), rect.bottom());
 
         RenderTarget rt;
         rt.width = rect.width();
@@ -296,39 +309,54 @@ namespace OpenLoco::Gfx
         _ctx.popRenderTarget();
     }
 
-    void SoftwareDrawingEngine::present()
+    // Converts a region of the virtual screen buffer into the screen texture
+    void SoftwareDrawingEngine::presentRegion(const Rect& rect)
     {
-        // Lock the surface before setting its pixels
-        if (SDL_MUSTLOCK(_screenSurface))
+        auto& rt = getScreenRT();
+        if (rt.bits == nullptr || _screenTexture == nullptr)
         {
-            if (SDL_LockSurface(_screenSurface) < 0)
-            {
-                return;
-            }
+            return;
         }
 
-        // Copy pixels from the virtual screen buffer to the surface
-        auto& rt = getScreenRT();
-        if (rt.bits != nullptr)
+        const SDL_Rect sdlRect{ rect.left(), rect.top(), rect.width(), rect.height() };
+        void* pixels = nullptr;
+        int32_t pitch = 0;
+        if (SDL_LockTexture(_screenTexture, &sdlRect, &pixels, &pitch) < 0)
         {
-            std::memcpy(_screenSurface->pixels, rt.bits, _screenSurface->pitch * _screenSurface->h);
+            Logging::error("SDL_LockTexture {}", SDL_GetError());
+            return;
         }
 
-        // Unlock the surface
-        if (SDL_MUSTLOCK(_screenSurface))
+        // Convert colours via palette mapping straight into the texture.
+        const auto stride = rt.width + rt.pitch;
+        const auto* src = rt.bits + rect.top() * stride + rect.left();
+        convertPaletteToPixels(src, stride, static_cast<uint8_t*>(pixels), pitch, rect.width(), rect.height(), _paletteLut);
+
+        SDL_UnlockTexture(_screenTexture);
+    }
+
+    void SoftwareDrawingEngine::present()
+    {
+        // Anything drawn without a render (e.g. the intro) draws straight to the screen without invalidating
+        if (!_hasRenderedSincePresent)
         {
-            SDL_UnlockSurface(_screenSurface);
+            _isPresentFullyDirty = true;
         }
+        _hasRenderedSincePresent = false;
 
-        // Convert colours via palette mapping onto the RGBA surface.
-        if (SDL_BlitSurface(_screenSurface, nullptr, _screenRGBASurface, nullptr))
+        // Only the regions that have changed need converting and uploading to the texture
+        if (_isPresentFullyDirty)
         {
-            Logging::error("SDL_BlitSurface {}", SDL_GetError());
-            return;
+            _presentGrid.traverseDirtyCells([](int32_t, int32_t, int32_t, int32_t) {});
+            presentRegion(Rect(0, 0, _screenRT.width, _screenRT.height));
+            _isPresentFullyDirty = false;
+        }
+        else
+        {
+            _presentGrid.traverseDirtyCells([this](int32_t left, int32_t top, int32_t right, int32_t bottom) {
+                presentRegion(Rect::fromLTRB(left, top, right, bottom));
+            });
         }
-
-        // Copy the RGBA pixels into screen texture.
-        SDL_UpdateTexture(_screenTexture, nullptr, _screenRGBASurface->pixels, _screenRGBASurface->pitch);
 
         const auto scaleFactor = Config::get().scaleFactor;
         if (scaleFactor > 1.0f)
@@ -407,6 +435,8 @@ namespace OpenLoco::Gfx
             to += stride;
             from += stride;
         }
+
+        _presentGrid.invalidate(dstX, dstY, dstX + width, dstY + height);
     }
 
     const Ui::ScreenInfo& SoftwareDrawingEngine::getScreenInfo() const
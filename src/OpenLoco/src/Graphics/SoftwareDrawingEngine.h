@@ -2,6 +2,7 @@
 
 #include "Graphics/Gfx.h"
 #include "InvalidationGrid.h"
+#include "PaletteConversion.h"
 #include "SoftwareDrawingContext.h"
 #include <OpenLoco/Engine/Ui/Rect.hpp>
 #include <algorithm>
@@ -9,7 +10,6 @@
 #include <memory>
 
 struct SDL_Palette;
-struct SDL_Surface;
 struct SDL_Window;
 struct SDL_Renderer;
 struct SDL_Texture;
@@ -46,6 +46,10 @@ namespace OpenLoco::Gfx
         // Invalidates a region, this forces it to be rendered next frame.
         void invalidateRegion(int32_t left, int32_t top, int32_t right, int32_t bottom);
 
+        // Forces the whole screen to be uploaded on the next present, needed when
+        // drawing directly to the screen without invalidating the region.
+        void invalidatePresent();
+
         void createPalette();
         SDL_Palette* getPalette() { return _palette; }
         void updatePalette(const PaletteEntry* entries, int32_t index, int32_t count);
@@ -70,12 +74,15 @@ namespace OpenLoco::Gfx
 
     private:
         void renderDirtyRegions();
+        void presentRegion(const Ui::Rect& rect);
+        void updatePaletteLut(int32_t index, int32_t count);
 
         SDL_Renderer* _renderer{};
         SDL_Window* _window{};
         SDL_Palette* _palette{};
-        SDL_Surface* _screenSurface{};
-        SDL_Surface* _screenRGBASurface{};
+        // Copy of the palette so the lookup table can be rebuilt when the texture format changes.
+        std::array<PaletteEntry, 256> _paletteEntries;
+        PaletteLut _paletteLut{};
 
         SDL_Texture* _screenTexture{};
         SDL_Texture* _scaledScreenTexture{};
@@ -85,6 +92,10 @@ namespace OpenLoco::Gfx
 
         SoftwareDrawingContext _ctx;
         InvalidationGrid _invalidationGrid;
+        // Regions of the screen changed since the last present.
+        InvalidationGrid _presentGrid;
+        bool _isPresentFullyDirty = true;
+        bool _hasRenderedSincePresent = false;
 
         bool _vsync = false;
     };
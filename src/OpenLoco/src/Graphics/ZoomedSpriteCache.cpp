@@ -0,0 +1,172 @@
+#include "ZoomedSpriteCache.h"
+#include "Graphics/Gfx.h"
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+namespace OpenLoco::Gfx::ZoomedSpriteCache
+{
+    // Per thread, painting of viewport columns runs in parallel
+    static constexpr size_t kMaxCacheBytes = 4 * 1024 * 1024;
+
+    static std::atomic<uint32_t> _generation = 0;
+
+    struct Key
+    {
+        const uint8_t* data;
+        uint8_t zoomLevel;
+        uint8_t phaseX;
+        uint8_t phaseY;
+
+        bool operator==(const Key&) const = default;
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key& key) const
+        {
+            const auto extra = (static_cast<size_t>(key.zoomLevel) << 16) | (static_cast<size_t>(key.phaseX) << 8) | key.phaseY;
+            return std::hash<const uint8_t*>{}(key.data) ^ (extra * 0x9E3779B97F4A7C15ULL);
+        }
+    };
+
+    struct Entry
+    {
+        Key key;
+        G1Element element;
+        std::vector<uint8_t> data;
+    };
+
+    struct Cache
+    {
+        uint32_t generation = 0;
+        size_t numBytes = 0;
+        std::list<Entry> entries; // Most recently used first
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> lookup;
+
+        void clear()
+        {
+            entries.clear();
+            lookup.clear();
+            numBytes = 0;
+        }
+    };
+
+    static thread_local Cache _cache;
+
+    // Produces the same pixels drawRLESprite samples at the zoom level when its source position
+    // is congruent to the phase, stored in the same RLE layout but with one pixel per sample.
+    static bool buildZoomedImage(const G1Element& element, const uint8_t zoomLevel, const uint8_t phaseX, const uint8_t phaseY, std::vector<uint8_t>& out)
+    {
+        const int32_t zoom = 1 << zoomLevel;
+        const int32_t numRows = element.height > phaseY ? (element.height - phaseY + zoom - 1) >> zoomLevel : 0;
+
+        out.assign(numRows * 2, 0);
+        const auto* src0 = element.offset;
+        for (int32_t row = 0; row < numRows; ++row)
+        {
+            const auto rowOffset = out.size();
+            if (rowOffset > 0xFFFF)
+            {
+                return false;
+            }
+            out[row * 2] = static_cast<uint8_t>(rowOffset);
+            out[row * 2 + 1] = static_cast<uint8_t>(rowOffset >> 8);
+
+            const int32_t y = phaseY + (row << zoomLevel);
+            const uint16_t lineOffset = src0[y * 2] | (src0[y * 2 + 1] << 8);
+            auto nextRun = src0 + lineOffset;
+
+            size_t lastChunk = SIZE_MAX;
+            auto isEndOfLine = false;
+            while (!isEndOfLine)
+            {
+                const auto* src = nextRun;
+                uint8_t dataSize = *src++;
+                const uint8_t firstPixelX = *src++;
+                isEndOfLine = (dataSize & 0x80) != 0;
+                dataSize &= 0x7F;
+                nextRun = src + dataSize;
+
+                // First column of the run congruent to the phase
+                const int32_t first = firstPixelX + ((phaseX - firstPixelX) & (zoom - 1));
+                const int32_t end = firstPixelX + dataSize;
+                if (first >= end)
+                {
+                    continue;
+                }
+
+                const auto numSamples = (end - first + zoom - 1) >> zoomLevel;
+                lastChunk = out.size();
+                out.push_back(static_cast<uint8_t>(numSamples));
+                out.push_back(static_cast<uint8_t>((first - phaseX) >> zoomLevel));
+                for (auto x = first; x < end; x += zoom)
+                {
+                    out.push_back(src[x - firstPixelX]);
+                }
+            }
+
+            if (lastChunk == SIZE_MAX)
+            {
+                // Every line needs at least one chunk to mark its end
+                out.push_back(0x80);
+                out.push_back(0);
+            }
+            else
+            {
+                out[lastChunk] |= 0x80;
+            }
+        }
+        return true;
+    }
+
+    const G1Element* get(const G1Element& element, const uint8_t zoomLevel, const uint8_t phaseX, const uint8_t phaseY)
+    {
+        auto& cache = _cache;
+        const auto generation = _generation.load(std::memory_order_relaxed);
+        if (cache.generation != generation)
+        {
+            cache.clear();
+            cache.generation = generation;
+        }
+
+        const Key key{ element.offset, zoomLevel, phaseX, phaseY };
+        if (auto it = cache.lookup.find(key); it != cache.lookup.end())
+        {
+            cache.entries.splice(cache.entries.begin(), cache.entries, it->second);
+            return &it->second->element;
+        }
+
+        Entry entry{ key, element, {} };
+        if (!buildZoomedImage(element, zoomLevel, phaseX, phaseY, entry.data))
+        {
+            return nullptr;
+        }
+        const int32_t zoom = 1 << zoomLevel;
+        entry.element.offset = entry.data.data();
+        entry.element.width = static_cast<int16_t>(std::max(0, (element.width - phaseX + zoom - 1) >> zoomLevel));
+        entry.element.height = static_cast<int16_t>(std::max(0, (element.height - phaseY + zoom - 1) >> zoomLevel));
+        entry.element.flags &= ~G1ElementFlags::hasZoomSprites;
+
+        cache.numBytes += entry.data.size();
+        cache.entries.push_front(std::move(entry));
+        cache.lookup.emplace(key, cache.entries.begin());
+
+        // Never evicts the entry just added
+        while (cache.numBytes > kMaxCacheBytes && cache.entries.size() > 1)
+        {
+            auto& oldest = cache.entries.back();
+            cache.numBytes -= oldest.data.size();
+            cache.lookup.erase(oldest.key);
+            cache.entries.pop_back();
+        }
+        return &cache.entries.front().element;
+    }
+
+    void invalidate()
+    {
+        _generation.fetch_add(1, std::memory_order_relaxed);
+    }
+}
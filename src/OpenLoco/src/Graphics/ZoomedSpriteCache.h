@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+
+namespace OpenLoco::Gfx
+{
+    struct G1Element;
+}
+
+namespace OpenLoco::Gfx::ZoomedSpriteCache
+{
+    // Returns an RLE image, drawable at zoom level 0, holding every (1 << zoomLevel)th column and row
+    // of the RLE element starting at the given column and row. It is built on first use and kept in
+    // a size bounded least recently used cache per thread. The result is only valid until the next
+    // call on the same thread. Returns nullptr if the element can not be cached.
+    const G1Element* get(const G1Element& element, uint8_t zoomLevel, uint8_t phaseX, uint8_t phaseY);
+
+    // Must be called whenever image data is (re)loaded as the cache is keyed on the image data address.
+    void invalidate();
+}
@@ -15,6 +15,7 @@
 #include "ViewportManager.h"
 #include "World/CompanyManager.h"
 #include "World/Industry.h"
+#include "World/Station.h"
 #include "World/StationManager.h"
 #include "World/TownManager.h"
 
@@ -124,6 +125,7 @@ namespace OpenLoco::World
                 elBuilding2.setConstructed(isConstructed);
                 elBuilding2.setUnk5u(newUnk5u);
                 elBuilding2.setAge(newAge);
+                invalidateCargoAcceptance(World::toTileSpace(pos));
                 Ui::ViewportManager::invalidate(pos, elBuilding2.baseHeight(), elBuilding2.clearHeight(), ZoomLevel::quarter);
             });
         }
@@ -185,7 +187,7 @@ namespace OpenLoco::World
                 town->var_19C[i][0] += producedAmount;
 
                 const auto size = buildingObj->hasFlags(BuildingObjectFlags::largeTile) ? World::TilePos2(2, 2) : World::TilePos2(1, 1);
-                town->var_19C[i][1] += StationManager::deliverCargoToNearbyStations(buildingObj->producedCargoType[i], producedAmount, loc, size) & 0xFF;
+                town->var_19C[i][1] += StationManager::queueCargoToNearbyStations(buildingObj->producedCargoType[i], producedAmount, loc, size) & 0xFF;
             }
         }
         return true;
@@ -11,6 +11,7 @@
 #include "ViewportManager.h"
 #include "World/Industry.h"
 #include "World/IndustryManager.h"
+#include "World/Station.h"
 #include <numeric>
 
 namespace OpenLoco::World
@@ -133,6 +134,12 @@ namespace OpenLoco::World
                     if (ind->under_construction >= ind->numTiles)
                     {
                         ind->under_construction = 0xFF;
+                        // Industries only accept cargo once construction has finished
+                        for (auto i = 0U; i < ind->numTiles; ++i)
+                        {
+                            const auto tilePos = World::toTileSpace(ind->tiles[i]);
+                            invalidateCargoAcceptance(tilePos, tilePos + World::TilePos2(1, 1));
+                        }
                         Ui::WindowManager::invalidate(Ui::WindowType::industry, enumValue(ind->id()));
                         Ui::WindowManager::invalidate(Ui::WindowType::industryList);
                     }
@@ -235,7 +242,7 @@ namespace OpenLoco::World
                         continue;
                     }
                     const auto station = elStation->stationId();
-                    ind->stationsInRange.set(enumValue(station), true);
+                    ind->addStationInRange(station);
                 }
             }
         }
@@ -36,6 +36,8 @@
 #include "WallElement.h"
 #include "World/CompanyManager.h"
 #include "World/IndustryManager.h"
+#include "World/Station.h"
+#include "World/StationManager.h"
 #include "World/TownManager.h"
 #include <OpenLoco/Diagnostics/Logging.h>
 #include <OpenLoco/Engine/World.hpp>
@@ -1064,6 +1066,9 @@ namespace OpenLoco::World::TileManager
         }
         pos.y -= World::kMapHeight;
 
+        // Buildings queue their produced cargo while the tiles are updated
+        StationManager::flushQueuedCargoDeliveries();
+
         const auto tilePos = World::toTileSpace(pos);
         const uint8_t shift = (tilePos.y << 4) + tilePos.x + 9;
         getGameState().tileUpdateStartLocation = World::toWorldSpace(TilePos2(shift & 0xF, shift >> 4));
@@ -1156,6 +1161,7 @@ namespace OpenLoco::World::TileManager
             }
         }
         Ui::ViewportManager::invalidate(pos, elBuilding.baseHeight(), elBuilding.clearHeight(), ZoomLevel::eighth);
+        invalidateCargoAcceptance(World::toTileSpace(pos));
         TileManager::removeElement(*reinterpret_cast<TileElement*>(&elBuilding));
     }
 
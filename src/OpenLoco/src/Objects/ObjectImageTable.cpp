@@ -1,5 +1,6 @@
 #include "ObjectImageTable.h"
 #include "Graphics/Gfx.h"
+#include "Graphics/ZoomedSpriteCache.h"
 #include <OpenLoco/Core/Exception.hpp>
 
 namespace OpenLoco::ObjectManager
@@ -42,6 +43,7 @@ namespace OpenLoco::ObjectManager
             *Gfx::getG1Element(_totalNumImages + i) = g1Element;
         }
         _totalNumImages += g1Header.numEntries;
+        Gfx::ZoomedSpriteCache::invalidate();
         return res;
     }
 
@@ -29,6 +29,7 @@
 #include "ObjectImageTable.h"
 #include "ObjectIndex.h"
 #include "ObjectStringTable.h"
+#include "Paint/TilePaintCache.h"
 #include "RegionObject.h"
 #include "RoadExtraObject.h"
 #include "RoadObject.h"
@@ -343,6 +344,7 @@ namespace OpenLoco::ObjectManager
 
     static void callObjectUnload(const ObjectType type, Object& obj)
     {
+        Paint::TilePaintCache::invalidate();
         return visitObject(type, obj, [](auto&& obj) {
             return obj->unload();
         });
@@ -350,6 +352,7 @@ namespace OpenLoco::ObjectManager
 
     static void callObjectLoad(const LoadedObjectHandle& handle, Object& obj, std::span<const std::byte> data, DependentObjects* dependencies = nullptr)
     {
+        Paint::TilePaintCache::invalidate();
         return visitObject(handle.type, obj, [&](auto&& obj) {
             return obj->load(handle, data, dependencies);
         });
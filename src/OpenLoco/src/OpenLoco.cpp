@@ -749,7 +749,7 @@ namespace OpenLoco
         return _time_since_last_tick;
     }
 
-    void simulateGame(const fs::path& savePath, int32_t ticks)
+    static void loadGameForSimulation(const fs::path& savePath)
     {
         Config::read();
 
@@ -781,9 +781,24 @@ namespace OpenLoco
                 Logging::info("File loaded. Starting simulation.");
             }
         }
+    }
+
+    void simulateGame(const fs::path& savePath, int32_t ticks)
+    {
+        loadGameForSimulation(savePath);
         tickLogic(ticks);
     }
 
+    void simulateGame(const fs::path& savePath, const std::function<void()>& onLoaded, const std::function<bool()>& shouldTick)
+    {
+        loadGameForSimulation(savePath);
+        onLoaded();
+        while (shouldTick())
+        {
+            tickLogic();
+        }
+    }
+
     // 0x00406D13
     static int main(const CommandLineOptions& options)
     {
@@ -20,6 +20,8 @@ namespace OpenLoco
     void* hInstance();
     void resetSubsystems();
     void simulateGame(const fs::path& path, int32_t ticks);
+    // Calls onLoaded once the save has loaded then keeps ticking until shouldTick returns false
+    void simulateGame(const fs::path& path, const std::function<void()>& onLoaded, const std::function<bool()>& shouldTick);
 
     void sub_431695(uint16_t var_F253A0);
     uint16_t getTimeSinceLastTick();
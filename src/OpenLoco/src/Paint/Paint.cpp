@@ -19,13 +19,25 @@
 #include "World/StationManager.h"
 #include "World/TownManager.h"
 #include <OpenLoco/Core/Numerics.hpp>
+#include <algorithm>
+#include <atomic>
+#include <vector>
 
 using namespace OpenLoco::Ui::ViewportInteraction;
 
 namespace OpenLoco::Paint
 {
+    thread_local PaintSession::PaintEntries PaintSession::_reusablePaintEntries;
+
+    // Largest number of paint entries used by any session, used to size the storage of new threads
+    static std::atomic<size_t> _paintEntriesHighWaterMark{ 0 };
+
     PaintSession::PaintSession(const Gfx::RenderTarget& rt, const SessionOptions& options)
+        : _paintEntries(std::move(_reusablePaintEntries))
     {
+        _paintEntries.clear();
+        _paintEntries.reserve(_paintEntriesHighWaterMark.load(std::memory_order_relaxed));
+
         _renderTarget = &rt;
         _lastPS = nullptr;
         for (auto& quadrant : _quadrants)
@@ -41,11 +53,21 @@ namespace OpenLoco::Paint
         currentRotation = options.rotation;
         _isHitTest = options.isHitTest;
         _skipTrackRoadSurfaces = options.skipTrackRoadSurfaces;
+        _tilePaintCacheKey = TilePaintCache::getSessionKey(rt, options);
 
         // TODO: unused
         _foregroundCullingHeight = options.foregroundCullHeight;
     }
 
+    PaintSession::~PaintSession()
+    {
+        auto highWaterMark = _paintEntriesHighWaterMark.load(std::memory_order_relaxed);
+        while (_paintEntries.size() > highWaterMark && !_paintEntriesHighWaterMark.compare_exchange_weak(highWaterMark, _paintEntries.size(), std::memory_order_relaxed))
+        {
+        }
+        _reusablePaintEntries = std::move(_paintEntries);
+    }
+
     void PaintSession::setEntityPosition(const World::Pos2& pos)
     {
         _spritePositionX = pos.x;
@@ -157,6 +179,11 @@ namespace OpenLoco::Paint
     // 0x004FD120
     PaintStringStruct* PaintSession::addToStringPlotList(const uint32_t amount, const StringId stringId, const uint16_t z, const int16_t xOffset, const int8_t* yOffsets, const uint16_t colour)
     {
+        if (_tileRecording != nullptr)
+        {
+            // String structs are not recorded
+            _tileRecording->isValid = false;
+        }
         auto* psString = allocatePaintStruct<PaintStringStruct>();
         if (psString == nullptr)
         {
@@ -184,6 +211,21 @@ namespace OpenLoco::Paint
         return addToPlotListAsParent(imageId, offset, offset, boundBoxSize);
     }
 
+    void PaintSession::addToPlotListAsParentMasked(ImageId imageId, ImageId maskedImageId, const World::Pos3& offset, const World::Pos3& boundBoxSize)
+    {
+        if (auto* call = recordCall(TilePaintCache::CallType::parent, imageId, offset, offset, boundBoxSize); call != nullptr)
+        {
+            call->maskedImageId = maskedImageId;
+            call->flags |= TilePaintCache::RecordedCallFlags::hasMaskedImage;
+        }
+        auto* ps = addToPlotListAsParentImpl(imageId, offset, offset, boundBoxSize);
+        if (ps != nullptr)
+        {
+            ps->flags |= PaintStructFlags::hasMaskedImage;
+            ps->maskedImageId = maskedImageId;
+        }
+    }
+
     static constexpr bool imageWithinRT(const Ui::viewport_pos& imagePos, const Gfx::G1Element& g1, const Gfx::RenderTarget& rt)
     {
         int32_t left = imagePos.x + g1.xOffset;
@@ -240,6 +282,12 @@ namespace OpenLoco::Paint
 
     // 0x004FD140
     PaintStruct* PaintSession::addToPlotListAsParent(ImageId imageId, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize)
+    {
+        recordCall(TilePaintCache::CallType::parent, imageId, offset, boundBoxOffset, boundBoxSize);
+        return addToPlotListAsParentImpl(imageId, offset, boundBoxOffset, boundBoxSize);
+    }
+
+    PaintStruct* PaintSession::addToPlotListAsParentImpl(ImageId imageId, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize)
     {
         _lastPS = nullptr;
 
@@ -261,6 +309,12 @@ namespace OpenLoco::Paint
 
     // 0x004FD200
     PaintStruct* PaintSession::addToPlotList4FD200(ImageId imageId, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize)
+    {
+        recordCall(TilePaintCache::CallType::parent4FD200, imageId, offset, boundBoxOffset, boundBoxSize);
+        return addToPlotList4FD200Impl(imageId, offset, boundBoxOffset, boundBoxSize);
+    }
+
+    PaintStruct* PaintSession::addToPlotList4FD200Impl(ImageId imageId, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize)
     {
         _lastPS = nullptr;
 
@@ -334,10 +388,16 @@ namespace OpenLoco::Paint
 
     // 0x004FD1E0
     PaintStruct* PaintSession::addToPlotListAsChild(ImageId imageId, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize)
+    {
+        recordCall(TilePaintCache::CallType::child, imageId, offset, boundBoxOffset, boundBoxSize);
+        return addToPlotListAsChildImpl(imageId, offset, boundBoxOffset, boundBoxSize);
+    }
+
+    PaintStruct* PaintSession::addToPlotListAsChildImpl(ImageId imageId, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize)
     {
         if (_lastPS == nullptr)
         {
-            return addToPlotListAsParent(imageId, offset, boundBoxOffset, boundBoxSize);
+            return addToPlotListAsParentImpl(imageId, offset, boundBoxOffset, boundBoxSize);
         }
         auto* ps = createNormalPaintStruct(imageId, offset, boundBoxOffset, boundBoxSize);
         if (ps == nullptr)
@@ -351,6 +411,12 @@ namespace OpenLoco::Paint
 
     // 0x004FD170
     PaintStruct* PaintSession::addToPlotListTrackRoad(ImageId imageId, uint32_t priority, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize)
+    {
+        recordCall(TilePaintCache::CallType::trackRoad, imageId, offset, boundBoxOffset, boundBoxSize, priority);
+        return addToPlotListTrackRoadImpl(imageId, priority, offset, boundBoxOffset, boundBoxSize);
+    }
+
+    PaintStruct* PaintSession::addToPlotListTrackRoadImpl(ImageId imageId, uint32_t priority, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize)
     {
         _lastPS = nullptr;
 
@@ -368,6 +434,12 @@ namespace OpenLoco::Paint
 
     // 0x004FD180
     PaintStruct* PaintSession::addToPlotListTrackRoadAddition(ImageId imageId, uint32_t priority, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize)
+    {
+        recordCall(TilePaintCache::CallType::trackRoadAddition, imageId, offset, boundBoxOffset, boundBoxSize, priority);
+        return addToPlotListTrackRoadAdditionImpl(imageId, priority, offset, boundBoxOffset, boundBoxSize);
+    }
+
+    PaintStruct* PaintSession::addToPlotListTrackRoadAdditionImpl(ImageId imageId, uint32_t priority, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize)
     {
         _lastPS = nullptr;
 
@@ -385,6 +457,27 @@ namespace OpenLoco::Paint
 
     // 0x0045E779
     AttachedPaintStruct* PaintSession::attachToPrevious(ImageId imageId, const Ui::Point& offset)
+    {
+        recordCall(TilePaintCache::CallType::attach, imageId, World::Pos3(offset.x, offset.y, 0), {}, {});
+        return attachToPreviousImpl(imageId, offset);
+    }
+
+    void PaintSession::attachToPreviousMasked(ImageId imageId, ImageId maskedImageId, const Ui::Point& offset)
+    {
+        if (auto* call = recordCall(TilePaintCache::CallType::attach, imageId, World::Pos3(offset.x, offset.y, 0), {}, {}); call != nullptr)
+        {
+            call->maskedImageId = maskedImageId;
+            call->flags |= TilePaintCache::RecordedCallFlags::hasMaskedImage;
+        }
+        auto* attached = attachToPreviousImpl(imageId, offset);
+        if (attached != nullptr)
+        {
+            attached->maskedImageId = maskedImageId;
+            attached->flags |= PaintStructFlags::hasMaskedImage;
+        }
+    }
+
+    AttachedPaintStruct* PaintSession::attachToPreviousImpl(ImageId imageId, const Ui::Point& offset)
     {
         if (_lastPS == nullptr)
         {
@@ -659,8 +752,9 @@ namespace OpenLoco::Paint
         return false;
     }
 
+    // The original list walk, kept to check arrangeStructsHelperRotation against
     template<uint8_t _TRotation>
-    static PaintStruct* arrangeStructsHelperRotation(PaintStruct* psNext, const uint16_t quadrantIndex, const QuadrantFlags flag)
+    static PaintStruct* arrangeStructsHelperRotationReference(PaintStruct* psNext, const uint16_t quadrantIndex, const QuadrantFlags flag)
     {
         PaintStruct* ps = nullptr;
 
@@ -776,6 +870,153 @@ namespace OpenLoco::Paint
         }
     }
 
+    static PaintStruct* arrangeStructsHelperReference(PaintStruct* psNext, uint16_t quadrantIndex, QuadrantFlags flag, uint8_t rotation)
+    {
+        switch (rotation)
+        {
+            case 0:
+                return arrangeStructsHelperRotationReference<0>(psNext, quadrantIndex, flag);
+            case 1:
+                return arrangeStructsHelperRotationReference<1>(psNext, quadrantIndex, flag);
+            case 2:
+                return arrangeStructsHelperRotationReference<2>(psNext, quadrantIndex, flag);
+            case 3:
+                return arrangeStructsHelperRotationReference<3>(psNext, quadrantIndex, flag);
+        }
+        return nullptr;
+    }
+
+    struct SortNode
+    {
+        PaintStructBoundBox bounds;
+        bool isNeighbour;
+        bool isPendingVisit;
+        PaintStruct* ps;
+    };
+
+    // Scratch space for arrangeStructsHelperRotation, sessions are sorted in parallel
+    static thread_local std::vector<SortNode> _sortNodes;
+    static thread_local std::vector<SortNode> _sortNodesMoved;
+
+    // Produces the same order as arrangeStructsHelperRotationReference. Each visited node moves the
+    // later neighbour nodes that it overlaps in front of itself, in reverse order, and then the
+    // moved nodes are visited next. The walk over the linked list is replayed on a compact array
+    // instead so that comparing against the remaining nodes does not chase pointers.
+    template<uint8_t TRotation>
+    static PaintStruct* arrangeStructsHelperRotation(PaintStruct* psNext, const uint16_t quadrantIndex, const QuadrantFlags flag)
+    {
+        PaintStruct* ps = nullptr;
+
+        // Get the first node in the specified quadrant.
+        do
+        {
+            ps = psNext;
+            psNext = psNext->nextQuadrantPS;
+            if (psNext == nullptr)
+            {
+                return ps;
+            }
+        } while (quadrantIndex > psNext->quadrantIndex);
+
+        auto* psQuadrantEntry = ps;
+
+        // Same as the reference, nodes not in range of this call keep their flags.
+        do
+        {
+            ps = ps->nextQuadrantPS;
+            if (ps == nullptr)
+            {
+                break;
+            }
+
+            if (ps->quadrantIndex > quadrantIndex + 1)
+            {
+                ps->quadrantFlags = QuadrantFlags::outsideQuadrant;
+            }
+            else if (ps->quadrantIndex == quadrantIndex + 1)
+            {
+                ps->quadrantFlags = QuadrantFlags::neighbour | QuadrantFlags::pendingVisit;
+            }
+            else if (ps->quadrantIndex == quadrantIndex)
+            {
+                ps->quadrantFlags = flag | QuadrantFlags::pendingVisit;
+            }
+        } while (ps->quadrantIndex <= quadrantIndex + 1);
+
+        // Every node the reference can reach before the end of the list or a node outside of the quadrant.
+        auto& nodes = _sortNodes;
+        nodes.clear();
+        PaintStruct* psEnd = psQuadrantEntry->nextQuadrantPS;
+        for (; psEnd != nullptr && !psEnd->hasQuadrantFlags(QuadrantFlags::outsideQuadrant); psEnd = psEnd->nextQuadrantPS)
+        {
+            nodes.push_back(SortNode{ psEnd->bounds, psEnd->hasQuadrantFlags(QuadrantFlags::neighbour), psEnd->hasQuadrantFlags(QuadrantFlags::pendingVisit), psEnd });
+        }
+
+        auto& moved = _sortNodesMoved;
+        size_t first = 0;
+        while (true)
+        {
+            // Get the first pending node in the quadrant list
+            while (first < nodes.size() && !nodes[first].isPendingVisit)
+            {
+                first++;
+            }
+            if (first == nodes.size())
+            {
+                break;
+            }
+
+            // Mark visited.
+            nodes[first].isPendingVisit = false;
+            const SortNode current = nodes[first];
+            const auto overlaps = [&initialBBox = current.bounds](const SortNode& node) {
+                return node.isNeighbour && checkBoundingBox<TRotation>(initialBBox, node.bounds);
+            };
+
+            // Compare current node against the remaining nodes, most have nothing to move.
+            auto firstMoved = first + 1;
+            while (firstMoved < nodes.size() && !overlaps(nodes[firstMoved]))
+            {
+                firstMoved++;
+            }
+            if (firstMoved == nodes.size())
+            {
+                first++;
+                continue;
+            }
+
+            // Overlapping nodes are moved in front of the current node in reverse order and visited next.
+            moved.clear();
+            auto numKept = firstMoved;
+            for (auto i = firstMoved; i < nodes.size(); ++i)
+            {
+                if (overlaps(nodes[i]))
+                {
+                    moved.push_back(nodes[i]);
+                }
+                else
+                {
+                    nodes[numKept++] = nodes[i];
+                }
+            }
+            const auto numMoved = moved.size();
+            std::move_backward(nodes.begin() + first + 1, nodes.begin() + numKept, nodes.end());
+            std::copy(moved.rbegin(), moved.rend(), nodes.begin() + first);
+            nodes[first + numMoved] = current;
+        }
+
+        ps = psQuadrantEntry;
+        for (auto& node : nodes)
+        {
+            node.ps->quadrantFlags &= ~QuadrantFlags::pendingVisit;
+            ps->nextQuadrantPS = node.ps;
+            ps = node.ps;
+        }
+        ps->nextQuadrantPS = psEnd;
+
+        return psQuadrantEntry;
+    }
+
     static PaintStruct* arrangeStructsHelper(PaintStruct* psNext, uint16_t quadrantIndex, QuadrantFlags flag, uint8_t rotation)
     {
         switch (rotation)
@@ -792,8 +1033,18 @@ namespace OpenLoco::Paint
         return nullptr;
     }
 
-    // 0x0045E7B5
     void PaintSession::arrangeStructs()
+    {
+        arrangeStructsImpl(false);
+    }
+
+    void PaintSession::arrangeStructsReference()
+    {
+        arrangeStructsImpl(true);
+    }
+
+    // 0x0045E7B5
+    void PaintSession::arrangeStructsImpl(bool useReference)
     {
         PaintStruct psHead{};
 
@@ -820,13 +1071,14 @@ namespace OpenLoco::Paint
             }
         } while (++quadrantIndex <= _quadrantFrontIndex);
 
-        PaintStruct* psCache = arrangeStructsHelper(
+        const auto helper = useReference ? arrangeStructsHelperReference : arrangeStructsHelper;
+        PaintStruct* psCache = helper(
             &psHead, _quadrantBackIndex & 0xFFFF, QuadrantFlags::neighbour, currentRotation);
 
         quadrantIndex = _quadrantBackIndex;
         while (++quadrantIndex < _quadrantFrontIndex)
         {
-            psCache = arrangeStructsHelper(psCache, quadrantIndex & 0xFFFF, QuadrantFlags::none, currentRotation);
+            psCache = helper(psCache, quadrantIndex & 0xFFFF, QuadrantFlags::none, currentRotation);
         }
 
         _paintHead = psHead.nextQuadrantPS;
@@ -1489,15 +1741,207 @@ namespace OpenLoco::Paint
     // 0x0045CA67
     void PaintSession::finaliseTrackRoadOrdering()
     {
+        recordCall(TilePaintCache::CallType::finaliseTrackRoad, {}, {}, {}, {});
         finaliseOrdering(_trackRoadPaintStructs);
     }
 
     // 0x0045CC1B
     void PaintSession::finaliseTrackRoadAdditionsOrdering()
     {
+        recordCall(TilePaintCache::CallType::finaliseTrackRoadAdditions, {}, {}, {}, {});
         finaliseOrdering(_trackRoadAdditionsPaintStructs);
     }
 
+    void PaintSession::resetLastPS()
+    {
+        recordCall(TilePaintCache::CallType::resetLastPS, {}, {}, {}, {});
+        _lastPS = nullptr;
+    }
+
+    PaintStruct* PaintSession::getLastPS()
+    {
+        if (_tileRecording != nullptr)
+        {
+            // The caller can do anything with the paint struct so the tile can not be replayed
+            _tileRecording->isValid = false;
+        }
+        return _lastPS;
+    }
+
+    void PaintSession::setLastPS(PaintStruct* ps)
+    {
+        if (_tileRecording != nullptr)
+        {
+            _tileRecording->isValid = false;
+        }
+        _lastPS = ps;
+    }
+
+    TilePaintCache::RecordedCall* PaintSession::recordCall(TilePaintCache::CallType type, ImageId imageId, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize, uint8_t priority)
+    {
+        if (_tileRecording == nullptr)
+        {
+            return nullptr;
+        }
+
+        auto& call = _tileRecording->calls.emplace_back();
+        call.imageId = imageId;
+        call.maskedImageId = {};
+        call.offset = offset;
+        call.boundBoxOffset = boundBoxOffset;
+        call.boundBoxSize = boundBoxSize;
+        call.currentItem = _currentItem;
+        call.type = type;
+        call.priority = priority;
+        call.itemType = _itemType;
+        call.trackModId = _trackModId;
+        call.flags = TilePaintCache::RecordedCallFlags::none;
+        // Values inherited from before the tile are taken from the live session on replay
+        if ((_tileRecording->written & TilePaintCache::TileStateFlags::itemType) != TilePaintCache::TileStateFlags::none)
+        {
+            call.flags |= TilePaintCache::RecordedCallFlags::hasItemType;
+        }
+        if ((_tileRecording->written & TilePaintCache::TileStateFlags::trackModId) != TilePaintCache::TileStateFlags::none)
+        {
+            call.flags |= TilePaintCache::RecordedCallFlags::hasTrackModId;
+        }
+        return &call;
+    }
+
+    TilePaintCache::TileState PaintSession::getTileState() const
+    {
+        TilePaintCache::TileState state{};
+        state.itemType = _itemType;
+        state.trackModId = _trackModId;
+        state.waterHeight = _waterHeight;
+        state.waterHeight2 = _waterHeight2;
+        state.surfaceHeight = _surfaceHeight;
+        state.surfaceSlope = _surfaceSlope;
+        state.mergeRoadBaseImage = _roadMergeBaseImage;
+        state.mergeRoadHeight = _roadMergeHeight;
+        state.currentItem = _currentItem;
+        state.unkVpY = _unkVpPositionY;
+        state.didPassSurface = _didPassSurface;
+        return state;
+    }
+
+    void PaintSession::beginTileRecording(TilePaintCache::Recording& recording)
+    {
+        recording.calls.clear();
+        recording.startState = getTileState();
+        recording.read = TilePaintCache::TileStateFlags::none;
+        recording.written = TilePaintCache::TileStateFlags::none;
+        recording.isValid = true;
+        _tileRecording = &recording;
+    }
+
+    void PaintSession::endTileRecording()
+    {
+        _tileRecording->endState = getTileState();
+        _tileRecording = nullptr;
+    }
+
+    void PaintSession::replayTileRecording(const TilePaintCache::Recording& recording)
+    {
+        using namespace TilePaintCache;
+
+        for (const auto& call : recording.calls)
+        {
+            _currentItem = call.currentItem;
+            if ((call.flags & RecordedCallFlags::hasItemType) != RecordedCallFlags::none)
+            {
+                _itemType = call.itemType;
+            }
+            if ((call.flags & RecordedCallFlags::hasTrackModId) != RecordedCallFlags::none)
+            {
+                _trackModId = call.trackModId;
+            }
+
+            switch (call.type)
+            {
+                case CallType::parent:
+                {
+                    auto* ps = addToPlotListAsParentImpl(call.imageId, call.offset, call.boundBoxOffset, call.boundBoxSize);
+                    if (ps != nullptr && (call.flags & RecordedCallFlags::hasMaskedImage) != RecordedCallFlags::none)
+                    {
+                        ps->flags |= PaintStructFlags::hasMaskedImage;
+                        ps->maskedImageId = call.maskedImageId;
+                    }
+                    break;
+                }
+                case CallType::parent4FD200:
+                    addToPlotList4FD200Impl(call.imageId, call.offset, call.boundBoxOffset, call.boundBoxSize);
+                    break;
+                case CallType::child:
+                    addToPlotListAsChildImpl(call.imageId, call.offset, call.boundBoxOffset, call.boundBoxSize);
+                    break;
+                case CallType::trackRoad:
+                    addToPlotListTrackRoadImpl(call.imageId, call.priority, call.offset, call.boundBoxOffset, call.boundBoxSize);
+                    break;
+                case CallType::trackRoadAddition:
+                    addToPlotListTrackRoadAdditionImpl(call.imageId, call.priority, call.offset, call.boundBoxOffset, call.boundBoxSize);
+                    break;
+                case CallType::attach:
+                {
+                    auto* attached = attachToPreviousImpl(call.imageId, Ui::Point(call.offset.x, call.offset.y));
+                    if (attached != nullptr && (call.flags & RecordedCallFlags::hasMaskedImage) != RecordedCallFlags::none)
+                    {
+                        attached->maskedImageId = call.maskedImageId;
+                        attached->flags |= PaintStructFlags::hasMaskedImage;
+                    }
+                    break;
+                }
+                case CallType::resetLastPS:
+                    _lastPS = nullptr;
+                    break;
+                case CallType::finaliseTrackRoad:
+                    finaliseOrdering(_trackRoadPaintStructs);
+                    break;
+                case CallType::finaliseTrackRoadAdditions:
+                    finaliseOrdering(_trackRoadAdditionsPaintStructs);
+                    break;
+            }
+        }
+
+        const auto& state = recording.endState;
+        const auto written = recording.written;
+        if ((written & TileStateFlags::itemType) != TileStateFlags::none)
+        {
+            _itemType = state.itemType;
+        }
+        if ((written & TileStateFlags::trackModId) != TileStateFlags::none)
+        {
+            _trackModId = state.trackModId;
+        }
+        if ((written & TileStateFlags::waterHeight) != TileStateFlags::none)
+        {
+            _waterHeight = state.waterHeight;
+        }
+        if ((written & TileStateFlags::waterHeight2) != TileStateFlags::none)
+        {
+            _waterHeight2 = state.waterHeight2;
+        }
+        if ((written & TileStateFlags::surfaceHeight) != TileStateFlags::none)
+        {
+            _surfaceHeight = state.surfaceHeight;
+        }
+        if ((written & TileStateFlags::surfaceSlope) != TileStateFlags::none)
+        {
+            _surfaceSlope = state.surfaceSlope;
+        }
+        if ((written & TileStateFlags::mergeRoadBaseImage) != TileStateFlags::none)
+        {
+            _roadMergeBaseImage = state.mergeRoadBaseImage;
+        }
+        if ((written & TileStateFlags::mergeRoadHeight) != TileStateFlags::none)
+        {
+            _roadMergeHeight = state.mergeRoadHeight;
+        }
+        _currentItem = state.currentItem;
+        _unkVpPositionY = state.unkVpY;
+        _didPassSurface = state.didPassSurface;
+    }
+
     // Note: Size includes for 1 extra at end that should never be anything other than 0xFF, 0xFF or 0, 0
     std::span<TunnelEntry> PaintSession::getTunnels(uint8_t edge)
     {
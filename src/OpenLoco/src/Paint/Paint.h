@@ -2,6 +2,7 @@
 
 #include "Graphics/ImageId.h"
 #include "Localisation/FormatArguments.hpp"
+#include "TilePaintCache.h"
 #include "Types.hpp"
 #include "Viewport.hpp"
 #include <OpenLoco/Core/EnumFlags.hpp>
@@ -234,9 +235,14 @@ namespace OpenLoco::Paint
     {
     public:
         PaintSession(const Gfx::RenderTarget& rt, const SessionOptions& options);
+        ~PaintSession();
+        PaintSession(const PaintSession&) = delete;
+        PaintSession& operator=(const PaintSession&) = delete;
 
         void generate();
         void arrangeStructs();
+        // The original sorting arrangeStructs must match, used by the paintsortcheck command
+        void arrangeStructsReference();
         void drawStructs(Gfx::DrawingContext& drawingCtx);
         void drawStringStructs(Gfx::DrawingContext& drawingCtx);
 
@@ -249,10 +255,26 @@ namespace OpenLoco::Paint
         int16_t getMaxHeight() { return _maxHeight; }
         uint32_t getRoadExits() { return _roadMergeExits; }
         void setRoadExits(uint32_t value) { _roadMergeExits = value; }
-        uint32_t getMergeRoadBaseImage() { return _roadMergeBaseImage; }
-        void setMergeRoadBaseImage(uint32_t value) { _roadMergeBaseImage = value; }
-        int16_t getMergeRoadHeight() { return _roadMergeHeight; }
-        void setMergeRoadHeight(int16_t value) { _roadMergeHeight = value; }
+        uint32_t getMergeRoadBaseImage()
+        {
+            markTileStateRead(TilePaintCache::TileStateFlags::mergeRoadBaseImage);
+            return _roadMergeBaseImage;
+        }
+        void setMergeRoadBaseImage(uint32_t value)
+        {
+            markTileStateWritten(TilePaintCache::TileStateFlags::mergeRoadBaseImage);
+            _roadMergeBaseImage = value;
+        }
+        int16_t getMergeRoadHeight()
+        {
+            markTileStateRead(TilePaintCache::TileStateFlags::mergeRoadHeight);
+            return _roadMergeHeight;
+        }
+        void setMergeRoadHeight(int16_t value)
+        {
+            markTileStateWritten(TilePaintCache::TileStateFlags::mergeRoadHeight);
+            _roadMergeHeight = value;
+        }
         uint16_t getMergeRoadStreetlight() { return _roadMergeStreetlightType; }
         void setMergeRoadStreetlight(uint16_t value) { _roadMergeStreetlightType = value; }
         int16_t getAdditionSupportHeight() { return _trackRoadAdditionSupports.height; }
@@ -262,10 +284,26 @@ namespace OpenLoco::Paint
         const SupportHeight& getSupportHeight(uint8_t segment) { return _supportSegments[segment]; }
         const BridgeEntry& getBridgeEntry() { return _bridgeEntry; }
         SegmentFlags get525CF8() { return _525CF8; }
-        int16_t getWaterHeight() { return _waterHeight; }
-        int16_t getWaterHeight2() { return _waterHeight2; }
-        int16_t getSurfaceHeight() { return _surfaceHeight; }
-        uint8_t getSurfaceSlope() { return _surfaceSlope; }
+        int16_t getWaterHeight()
+        {
+            markTileStateRead(TilePaintCache::TileStateFlags::waterHeight);
+            return _waterHeight;
+        }
+        int16_t getWaterHeight2()
+        {
+            markTileStateRead(TilePaintCache::TileStateFlags::waterHeight2);
+            return _waterHeight2;
+        }
+        int16_t getSurfaceHeight()
+        {
+            markTileStateRead(TilePaintCache::TileStateFlags::surfaceHeight);
+            return _surfaceHeight;
+        }
+        uint8_t getSurfaceSlope()
+        {
+            markTileStateRead(TilePaintCache::TileStateFlags::surfaceSlope);
+            return _surfaceSlope;
+        }
         SegmentFlags getOccupiedAdditionSupportSegments() { return _trackRoadAdditionSupports.occupiedSegments; }
         World::Pos2 getUnkPosition()
         {
@@ -279,9 +317,21 @@ namespace OpenLoco::Paint
         // TileElement or Entity
         void setCurrentItem(void* item) { _currentItem = item; }
         void* getCurrentItem() { return _currentItem; }
-        void setItemType(const Ui::ViewportInteraction::InteractionItem type) { _itemType = type; }
-        Ui::ViewportInteraction::InteractionItem getItemType() { return _itemType; }
-        void setTrackModId(const uint8_t mod) { _trackModId = mod; }
+        void setItemType(const Ui::ViewportInteraction::InteractionItem type)
+        {
+            markTileStateWritten(TilePaintCache::TileStateFlags::itemType);
+            _itemType = type;
+        }
+        Ui::ViewportInteraction::InteractionItem getItemType()
+        {
+            markTileStateRead(TilePaintCache::TileStateFlags::itemType);
+            return _itemType;
+        }
+        void setTrackModId(const uint8_t mod)
+        {
+            markTileStateWritten(TilePaintCache::TileStateFlags::trackModId);
+            _trackModId = mod;
+        }
         void setEntityPosition(const World::Pos2& pos);
         void setMapPosition(const World::Pos2& pos);
         void setUnkPosition(const World::Pos2& pos);
@@ -296,7 +346,7 @@ namespace OpenLoco::Paint
         void setBridgeEntry(const BridgeEntry newValue) { _bridgeEntry = newValue; }
         void resetTileColumn(const Ui::Point& pos);
         void resetTunnels();
-        void resetLastPS() { _lastPS = nullptr; }
+        void resetLastPS();
         void setBoundingBoxOffset(const World::Pos3& bbox) { _boundingBoxOffset = bbox; }
         World::Pos3 getBoundingBoxOffset() const { return _boundingBoxOffset; }
         void finaliseTrackRoadOrdering();
@@ -305,15 +355,38 @@ namespace OpenLoco::Paint
         void insertTunnel(coord_t z, uint8_t tunnelType, uint8_t edge);
         void insertTunnels(const std::array<int16_t, 4>& tunnelHeights, coord_t height, uint8_t tunnelType);
         void setDidPassSurface(bool value) { _didPassSurface = value; }
-        void setSurfaceSlope(uint8_t slope) { _surfaceSlope = slope; }
-        void setSurfaceHeight(int16_t height) { _surfaceHeight = height; }
-        void setWaterHeight(int16_t height) { _waterHeight = height; }
-        void setWaterHeight2(int16_t height) { _waterHeight2 = height; }
-        PaintStruct* getLastPS() { return _lastPS; }
-        void setLastPS(PaintStruct* ps) { _lastPS = ps; }
+        void setSurfaceSlope(uint8_t slope)
+        {
+            markTileStateWritten(TilePaintCache::TileStateFlags::surfaceSlope);
+            _surfaceSlope = slope;
+        }
+        void setSurfaceHeight(int16_t height)
+        {
+            markTileStateWritten(TilePaintCache::TileStateFlags::surfaceHeight);
+            _surfaceHeight = height;
+        }
+        void setWaterHeight(int16_t height)
+        {
+            markTileStateWritten(TilePaintCache::TileStateFlags::waterHeight);
+            _waterHeight = height;
+        }
+        void setWaterHeight2(int16_t height)
+        {
+            markTileStateWritten(TilePaintCache::TileStateFlags::waterHeight2);
+            _waterHeight2 = height;
+        }
+        PaintStruct* getLastPS();
+        void setLastPS(PaintStruct* ps);
         bool isHitTest() const { return _isHitTest; }
         bool skipTrackRoadSurfaces() const { return _skipTrackRoadSurfaces; }
 
+        // See TilePaintCache.h
+        const std::optional<TilePaintCache::SessionKey>& getTilePaintCacheKey() const { return _tilePaintCacheKey; }
+        TilePaintCache::TileState getTileState() const;
+        void beginTileRecording(TilePaintCache::Recording& recording);
+        void endTileRecording();
+        void replayTileRecording(const TilePaintCache::Recording& recording);
+
         /*
          * @param amount    @<eax>
          * @param stringId  @<bx>
@@ -352,6 +425,9 @@ namespace OpenLoco::Paint
          */
         PaintStruct* addToPlotListAsParent(ImageId imageId, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize);
 
+        // As addToPlotListAsParent but the image is drawn through the mask image
+        void addToPlotListAsParentMasked(ImageId imageId, ImageId maskedImageId, const World::Pos3& offset, const World::Pos3& boundBoxSize);
+
         /*
          * @param rotation @<ebp>
          * @param imageId  @<ebx>
@@ -429,6 +505,9 @@ namespace OpenLoco::Paint
          */
         AttachedPaintStruct* attachToPrevious(ImageId imageId, const Ui::Point& offset);
 
+        // As attachToPrevious but the image is drawn through the mask image
+        void attachToPreviousMasked(ImageId imageId, ImageId maskedImageId, const Ui::Point& offset);
+
     private:
         void generateTilesAndEntities(GenerationParameters&& p);
         void finaliseOrdering(std::span<PaintStruct*> paintStructs);
@@ -442,7 +521,13 @@ namespace OpenLoco::Paint
             PaintEntry() {}
         };
 
-        sfl::segmented_vector<PaintEntry, 128> _paintEntries;
+        using PaintEntries = sfl::segmented_vector<PaintEntry, 128>;
+
+        // Storage of the last session destroyed on this thread, reused by the next session so
+        // that the paint entries are not reallocated for every column of every frame.
+        static thread_local PaintEntries _reusablePaintEntries;
+
+        PaintEntries _paintEntries;
 
         const Gfx::RenderTarget* _renderTarget{};
         PaintStruct* _paintHead{};
@@ -505,6 +590,8 @@ namespace OpenLoco::Paint
         uint16_t _roadMergeStreetlightType{};
         bool _isHitTest{};             // 0x0050BF68
         bool _skipTrackRoadSurfaces{}; // 0x00522095 bit 0
+        std::optional<TilePaintCache::SessionKey> _tilePaintCacheKey;
+        TilePaintCache::Recording* _tileRecording{};
 
         // From OpenRCT2 equivalent fields not found yet or new
         // AttachedPaintStruct* unkF1AD2C;              // no equivalent
@@ -527,7 +614,29 @@ namespace OpenLoco::Paint
 
             return specificPs;
         }
+        void markTileStateRead(TilePaintCache::TileStateFlags field)
+        {
+            if (_tileRecording != nullptr && (_tileRecording->written & field) == TilePaintCache::TileStateFlags::none)
+            {
+                _tileRecording->read |= field;
+            }
+        }
+        void markTileStateWritten(TilePaintCache::TileStateFlags field)
+        {
+            if (_tileRecording != nullptr)
+            {
+                _tileRecording->written |= field;
+            }
+        }
+        TilePaintCache::RecordedCall* recordCall(TilePaintCache::CallType type, ImageId imageId, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize, uint8_t priority = 0);
+        PaintStruct* addToPlotListAsParentImpl(ImageId imageId, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize);
+        PaintStruct* addToPlotList4FD200Impl(ImageId imageId, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize);
+        PaintStruct* addToPlotListAsChildImpl(ImageId imageId, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize);
+        PaintStruct* addToPlotListTrackRoadImpl(ImageId imageId, uint32_t priority, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize);
+        PaintStruct* addToPlotListTrackRoadAdditionImpl(ImageId imageId, uint32_t priority, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize);
+        AttachedPaintStruct* attachToPreviousImpl(ImageId imageId, const Ui::Point& offset);
         void attachStringStruct(PaintStringStruct& psString);
+        void arrangeStructsImpl(bool useReference);
         void addPSToQuadrant(PaintStruct& ps);
         PaintStruct* createNormalPaintStruct(ImageId imageId, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize);
     };
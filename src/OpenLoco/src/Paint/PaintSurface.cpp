@@ -849,12 +849,7 @@ namespace OpenLoco::Paint
             const auto variation = 38 + cl;
             const auto maskImageId = ImageId(snowObj->image).withIndexOffset(variation);
 
-            auto* attachedPs = session.attachToPrevious(baseImageId, { 0, 0 });
-            if (attachedPs != nullptr)
-            {
-                attachedPs->maskedImageId = maskImageId;
-                attachedPs->flags |= PaintStructFlags::hasMaskedImage;
-            }
+            session.attachToPreviousMasked(baseImageId, maskImageId, { 0, 0 });
         }
         else
         {
@@ -862,23 +857,13 @@ namespace OpenLoco::Paint
             const auto variation = landObj->numImagesPerGrowthStage * neighbour.growthStage + 19 + cl;
             const auto maskImageId = ImageId(landObj->image).withIndexOffset(variation);
 
-            auto* attachedPs = session.attachToPrevious(baseImageId, { 0, 0 });
-            if (attachedPs != nullptr)
-            {
-                attachedPs->maskedImageId = maskImageId;
-                attachedPs->flags |= PaintStructFlags::hasMaskedImage;
-            }
+            session.attachToPreviousMasked(baseImageId, maskImageId, { 0, 0 });
         }
     }
 
     static void paintMainUndergroundSurface(PaintSession& session, uint32_t imageIndex, uint8_t displaySlope)
     {
-        auto* attachedPs = session.attachToPrevious(ImageId(imageIndex), { 0, 0 });
-        if (attachedPs != nullptr)
-        {
-            attachedPs->maskedImageId = ImageId(kGridlinesBoxFromSlope[displaySlope]);
-            attachedPs->flags |= PaintStructFlags::hasMaskedImage;
-        }
+        session.attachToPreviousMasked(ImageId(imageIndex), ImageId(kGridlinesBoxFromSlope[displaySlope]), { 0, 0 });
     }
 
     constexpr std::array<uint8_t, 4> kEdgeFactorOffset = { 0, 16, 16, 0 };
@@ -1200,12 +1185,7 @@ namespace OpenLoco::Paint
         const auto image = ImageId(cliffEdgeImageBase).withIndexOffset(factor + (height & 0xF));
         const World::Pos3 offset = kEdgeImageOffset[edge] + World::Pos3(0, 0, height * kMicroZStep);
         const World::Pos3 boundBoxSize = kEdgeBoundingBoxSize[edge];
-        auto* ps = session.addToPlotListAsParent(image, offset, boundBoxSize);
-        if (ps != nullptr)
-        {
-            ps->flags |= PaintStructFlags::hasMaskedImage;
-            ps->maskedImageId = ImageId(edgeSlopeMaskImageIndex);
-        }
+        session.addToPlotListAsParentMasked(image, ImageId(edgeSlopeMaskImageIndex), offset, boundBoxSize);
     }
 
     static void paintSurfaceCliffEdgeImpl(PaintSession& session, uint8_t edge, int16_t baseHeight, const EdgeHeight& edgeHeight, uint32_t cliffEdgeImageBase)
@@ -1621,12 +1601,7 @@ namespace OpenLoco::Paint
         if (snowImage.has_value() && zoomLevel <= 2)
         {
             const auto imageId = ImageId(snowImage->baseImage);
-            auto* attachedPs = session.attachToPrevious(imageId, { 0, 0 });
-            if (attachedPs != nullptr)
-            {
-                attachedPs->flags |= PaintStructFlags::hasMaskedImage;
-                attachedPs->maskedImageId = ImageId(snowImage->imageMask);
-            }
+            session.attachToPreviousMasked(imageId, ImageId(snowImage->imageMask), { 0, 0 });
         }
 
         if (zoomLevel == 0
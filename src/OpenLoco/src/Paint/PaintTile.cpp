@@ -27,6 +27,7 @@
 #include "PaintTrack.h"
 #include "PaintTree.h"
 #include "PaintWall.h"
+#include "TilePaintCache.h"
 #include "Ui.h"
 #include "Ui/ViewportInteraction.h"
 #include "World/Station.h"
@@ -307,6 +308,12 @@ namespace OpenLoco::Paint
         }
 
         auto tile = TileManager::get(loc);
+        if (TilePaintCache::tryReplay(session, tile, TilePaintCache::Pass::main))
+        {
+            return;
+        }
+
+        TilePaintCache::beginRecording(session);
         for (auto& el : tile)
         {
             session.setUnkVpY(vpPos->y - el.baseHeight());
@@ -371,6 +378,7 @@ namespace OpenLoco::Paint
             }
             paintTileElementsEndLoop(session, el);
         }
+        TilePaintCache::endRecording(session, tile, TilePaintCache::Pass::main);
     }
 
     // 0x004617C6
@@ -388,6 +396,12 @@ namespace OpenLoco::Paint
         }
 
         auto tile = TileManager::get(loc);
+        if (TilePaintCache::tryReplay(session, tile, TilePaintCache::Pass::secondary))
+        {
+            return;
+        }
+
+        TilePaintCache::beginRecording(session);
         for (auto& el : tile)
         {
             session.setUnkVpY(vpPos->y - el.baseHeight());
@@ -438,5 +452,6 @@ namespace OpenLoco::Paint
             }
             paintTileElementsEndLoop(session, el);
         }
+        TilePaintCache::endRecording(session, tile, TilePaintCache::Pass::secondary);
     }
 }
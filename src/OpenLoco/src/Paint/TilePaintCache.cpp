@@ -0,0 +1,373 @@
+#include "TilePaintCache.h"
+#include "Config.h"
+#include "GameState.h"
+#include "Graphics/RenderTarget.h"
+#include "Map/BuildingElement.h"
+#include "Map/MapSelection.h"
+#include "Map/RoadElement.h"
+#include "Map/SurfaceElement.h"
+#include "Map/TileManager.h"
+#include "Map/TrackElement.h"
+#include "Objects/BuildingObject.h"
+#include "Paint.h"
+#include "World/CompanyManager.h"
+#include "ZoomLevel.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+namespace OpenLoco::Paint::TilePaintCache
+{
+    // Includes the entry slots of the allocated views
+    static constexpr size_t kMaxCacheBytes = 64 * 1024 * 1024;
+    // Views that have not been painted for this long are freed
+    static constexpr auto kMaxViewIdleTime = std::chrono::seconds(10);
+    static constexpr size_t kNumLocks = 64;
+    static constexpr size_t kNumNeighbours = 4;
+    static constexpr size_t kNumRotations = 4;
+    static constexpr size_t kNumViews = kNumRotations * ZoomLevel::max;
+
+    static constexpr std::array<World::TilePos2, kNumNeighbours> kNeighbourOffsets = {
+        World::TilePos2{ -1, 0 },
+        World::TilePos2{ 0, 1 },
+        World::TilePos2{ 1, 0 },
+        World::TilePos2{ 0, -1 },
+    };
+
+    using ElementData = std::array<uint8_t, World::kTileElementSize>;
+
+    struct Entry
+    {
+        SessionKey key;
+        const World::TileElement* firstElement;
+        std::vector<ElementData> elements;
+        // The surface painter blends with and draws cliffs against the neighbouring surfaces
+        std::array<std::optional<ElementData>, kNumNeighbours> neighbourSurfaces;
+        Recording recording;
+    };
+
+    static std::atomic<uint32_t> _generation = 0;
+    static std::atomic<size_t> _numBytes = 0;
+    // Entries of each rotation and zoom level so that viewports of different views do not replace
+    // each other's entries. Allocated by the first trim for the view, the cache is not used until then.
+    static std::array<std::vector<std::shared_ptr<const Entry>>, kNumViews> _entries;
+    static std::array<std::chrono::steady_clock::time_point, kNumViews> _viewLastTrimmed;
+    static std::array<std::mutex, kNumLocks> _locks;
+
+    static thread_local Recording _recording;
+
+    bool TileState::matches(const TileState& other, TileStateFlags fields) const
+    {
+        const auto check = [fields](TileStateFlags field, bool isEqual) {
+            return (fields & field) == TileStateFlags::none || isEqual;
+        };
+        return check(TileStateFlags::itemType, itemType == other.itemType)
+            && check(TileStateFlags::trackModId, trackModId == other.trackModId)
+            && check(TileStateFlags::waterHeight, waterHeight == other.waterHeight)
+            && check(TileStateFlags::waterHeight2, waterHeight2 == other.waterHeight2)
+            && check(TileStateFlags::surfaceHeight, surfaceHeight == other.surfaceHeight)
+            && check(TileStateFlags::surfaceSlope, surfaceSlope == other.surfaceSlope)
+            && check(TileStateFlags::mergeRoadBaseImage, mergeRoadBaseImage == other.mergeRoadBaseImage)
+            && check(TileStateFlags::mergeRoadHeight, mergeRoadHeight == other.mergeRoadHeight);
+    }
+
+    static size_t getViewIndex(uint8_t rotation, uint8_t zoomLevel)
+    {
+        return rotation * ZoomLevel::max + zoomLevel;
+    }
+
+    std::optional<SessionKey> getSessionKey(const Gfx::RenderTarget& rt, const SessionOptions& options)
+    {
+        if (options.isHitTest || options.skipTrackRoadSurfaces || options.rotation >= kNumRotations || rt.zoomLevel >= ZoomLevel::max)
+        {
+            return std::nullopt;
+        }
+        if (_entries[getViewIndex(options.rotation, rt.zoomLevel)].empty())
+        {
+            return std::nullopt;
+        }
+        // Selections are drawn on to the surfaces of the selected tiles
+        if (World::hasMapSelectionFlag(World::MapSelectionFlags::enable | World::MapSelectionFlags::enableConstruct | World::MapSelectionFlags::catchmentArea))
+        {
+            return std::nullopt;
+        }
+
+        const auto& config = Config::get();
+        SessionKey key{};
+        key.generation = _generation.load(std::memory_order_relaxed);
+        key.rotation = options.rotation;
+        key.zoomLevel = rt.zoomLevel;
+        key.viewFlags = options.viewFlags;
+        key.landscapeSmoothing = config.landscapeSmoothing;
+        key.showAiPlanningGhosts = showAiPlanningGhosts();
+        key.heightMarkerOffset = config.heightMarkerOffset;
+        key.seaLevel = getGameState().seaLevel;
+        key.secondaryPlayer = CompanyManager::getSecondaryPlayerId();
+        for (auto i = 0U; i < key.companyColours.size(); ++i)
+        {
+            key.companyColours[i] = CompanyManager::getCompanyColour(static_cast<CompanyId>(i));
+        }
+        return key;
+    }
+
+    // Elements that animate or depend on state outside of the tile
+    static bool isCacheable(const World::TileElement& el)
+    {
+        if (el.isGhost())
+        {
+            return false;
+        }
+        switch (el.type())
+        {
+            case World::ElementType::station:
+            case World::ElementType::industry:
+                return false;
+
+            case World::ElementType::surface:
+            {
+                const auto& elSurface = el.get<World::SurfaceElement>();
+                // Waves and industry farm fields
+                return !(elSurface.water() && elSurface.isFlag6()) && !elSurface.isIndustrial();
+            }
+            case World::ElementType::track:
+                return !el.get<World::TrackElement>().hasGhostMods();
+
+            case World::ElementType::road:
+            {
+                const auto& elRoad = el.get<World::RoadElement>();
+                return !elRoad.hasGhostMods() && !elRoad.hasLevelCrossing();
+            }
+            case World::ElementType::building:
+            {
+                const auto* buildingObj = el.get<World::BuildingElement>().getObject();
+                if (buildingObj->numElevatorSequences != 0)
+                {
+                    return false;
+                }
+                for (const auto& partAnim : buildingObj->getBuildingPartAnimations())
+                {
+                    if (partAnim.numFrames > 1)
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            default:
+                return true;
+        }
+    }
+
+    static std::optional<ElementData> getNeighbourSurface(const World::TilePos2& pos)
+    {
+        if (!World::validCoords(pos))
+        {
+            return std::nullopt;
+        }
+        const auto* elSurface = World::TileManager::get(pos).surface();
+        if (elSurface == nullptr)
+        {
+            return std::nullopt;
+        }
+        ElementData data;
+        std::memcpy(data.data(), elSurface, data.size());
+        return data;
+    }
+
+    static size_t getEntryIndex(const World::Tile& tile, Pass pass)
+    {
+        return (static_cast<size_t>(tile.pos.y) * World::kMapColumns + tile.pos.x) * 2 + enumValue(pass);
+    }
+
+    static size_t getEntrySize(const Entry& entry)
+    {
+        return sizeof(Entry) + entry.elements.size() * sizeof(ElementData) + entry.recording.calls.size() * sizeof(RecordedCall);
+    }
+
+    static bool isEntryValid(const Entry& entry, const SessionKey& key, World::Tile& tile)
+    {
+        if (!(entry.key == key) || entry.firstElement != tile[0])
+        {
+            return false;
+        }
+
+        size_t i = 0;
+        for (const auto& el : tile)
+        {
+            if (i == entry.elements.size() || std::memcmp(&el, entry.elements[i].data(), World::kTileElementSize) != 0)
+            {
+                return false;
+            }
+            i++;
+        }
+        if (i != entry.elements.size())
+        {
+            return false;
+        }
+
+        for (auto n = 0U; n < kNumNeighbours; ++n)
+        {
+            if (getNeighbourSurface(tile.pos + kNeighbourOffsets[n]) != entry.neighbourSurfaces[n])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool tryReplay(PaintSession& session, World::Tile& tile, Pass pass)
+    {
+        const auto& key = session.getTilePaintCacheKey();
+        if (!key.has_value())
+        {
+            return false;
+        }
+
+        const auto index = getEntryIndex(tile, pass);
+        std::shared_ptr<const Entry> entry;
+        {
+            std::lock_guard lock(_locks[index % kNumLocks]);
+            entry = _entries[getViewIndex(key->rotation, key->zoomLevel)][index];
+        }
+        if (entry == nullptr || !isEntryValid(*entry, *key, tile))
+        {
+            return false;
+        }
+
+        const auto& recording = entry->recording;
+        if (!recording.startState.matches(session.getTileState(), recording.read))
+        {
+            return false;
+        }
+        session.replayTileRecording(recording);
+        return true;
+    }
+
+    void beginRecording(PaintSession& session)
+    {
+        if (!session.getTilePaintCacheKey().has_value())
+        {
+            return;
+        }
+        session.beginTileRecording(_recording);
+    }
+
+    void endRecording(PaintSession& session, World::Tile& tile, Pass pass)
+    {
+        const auto& key = session.getTilePaintCacheKey();
+        if (!key.has_value())
+        {
+            return;
+        }
+        session.endTileRecording();
+
+        if (!_recording.isValid || _numBytes.load(std::memory_order_relaxed) > kMaxCacheBytes)
+        {
+            return;
+        }
+
+        for (const auto& el : tile)
+        {
+            if (!isCacheable(el))
+            {
+                return;
+            }
+        }
+
+        auto entry = std::make_shared<Entry>();
+        entry->key = *key;
+        entry->firstElement = tile[0];
+        for (const auto& el : tile)
+        {
+            auto& data = entry->elements.emplace_back();
+            std::memcpy(data.data(), &el, data.size());
+        }
+        for (auto n = 0U; n < kNumNeighbours; ++n)
+        {
+            entry->neighbourSurfaces[n] = getNeighbourSurface(tile.pos + kNeighbourOffsets[n]);
+        }
+        entry->recording.calls.assign(_recording.calls.begin(), _recording.calls.end());
+        entry->recording.startState = _recording.startState;
+        entry->recording.endState = _recording.endState;
+        entry->recording.read = _recording.read;
+        entry->recording.written = _recording.written;
+        entry->recording.isValid = true;
+
+        _numBytes.fetch_add(getEntrySize(*entry), std::memory_order_relaxed);
+
+        const auto index = getEntryIndex(tile, pass);
+        std::shared_ptr<const Entry> oldEntry = std::move(entry);
+        {
+            std::lock_guard lock(_locks[index % kNumLocks]);
+            std::swap(_entries[getViewIndex(key->rotation, key->zoomLevel)][index], oldEntry);
+        }
+        if (oldEntry != nullptr)
+        {
+            _numBytes.fetch_sub(getEntrySize(*oldEntry), std::memory_order_relaxed);
+        }
+    }
+
+    static constexpr size_t getViewSlotsSize()
+    {
+        return static_cast<size_t>(World::kMapSize) * 2 * sizeof(std::shared_ptr<const Entry>);
+    }
+
+    static void freeView(std::vector<std::shared_ptr<const Entry>>& viewEntries)
+    {
+        if (viewEntries.empty())
+        {
+            return;
+        }
+
+        auto numBytes = getViewSlotsSize();
+        for (const auto& entry : viewEntries)
+        {
+            if (entry != nullptr)
+            {
+                numBytes += getEntrySize(*entry);
+            }
+        }
+        viewEntries = std::vector<std::shared_ptr<const Entry>>();
+        _numBytes.fetch_sub(numBytes, std::memory_order_relaxed);
+    }
+
+    void trim(uint8_t rotation, uint8_t zoomLevel)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        const auto isCacheableView = rotation < kNumRotations && zoomLevel < ZoomLevel::max;
+        const auto viewIndex = isCacheableView ? getViewIndex(rotation, zoomLevel) : kNumViews;
+
+        // Over budget the other views are dropped first, then the entries of this view
+        const auto isOverBudget = _numBytes.load(std::memory_order_relaxed) > kMaxCacheBytes;
+        for (auto i = 0U; i < kNumViews; ++i)
+        {
+            if (i != viewIndex && (isOverBudget || now - _viewLastTrimmed[i] > kMaxViewIdleTime))
+            {
+                freeView(_entries[i]);
+            }
+        }
+        if (!isCacheableView)
+        {
+            return;
+        }
+
+        auto& viewEntries = _entries[viewIndex];
+        if (_numBytes.load(std::memory_order_relaxed) > kMaxCacheBytes)
+        {
+            freeView(viewEntries);
+        }
+        _viewLastTrimmed[viewIndex] = now;
+        if (viewEntries.empty())
+        {
+            viewEntries.resize(static_cast<size_t>(World::kMapSize) * 2);
+            _numBytes.fetch_add(getViewSlotsSize(), std::memory_order_relaxed);
+        }
+    }
+
+    void invalidate()
+    {
+        _generation.fetch_add(1, std::memory_order_relaxed);
+    }
+}
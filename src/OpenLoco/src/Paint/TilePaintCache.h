@@ -0,0 +1,165 @@
+#pragma once
+
+#include "Graphics/Colour.h"
+#include "Graphics/ImageId.h"
+#include "S5/Limits.h"
+#include "Types.hpp"
+#include "Viewport.hpp"
+#include <OpenLoco/Core/EnumFlags.hpp>
+#include <OpenLoco/Engine/World.hpp>
+#include <array>
+#include <optional>
+#include <vector>
+
+namespace OpenLoco::Gfx
+{
+    struct RenderTarget;
+}
+
+namespace OpenLoco::Ui::ViewportInteraction
+{
+    enum class InteractionItem : uint8_t;
+}
+
+namespace OpenLoco::World
+{
+    class Tile;
+}
+
+namespace OpenLoco::Paint
+{
+    struct PaintSession;
+    struct SessionOptions;
+}
+
+// Static tile content (land, track, roads, trees, ...) paints the same paint structs every frame.
+// The first time a tile is painted the calls it makes to the paint session are recorded, the next
+// time the same tile is painted with unchanged content the calls are replayed instead of running
+// the tile painters again. Replayed calls are still culled against the render target of the session
+// so a single recording serves every viewport column that the tile overlaps.
+namespace OpenLoco::Paint::TilePaintCache
+{
+    // paintTileElements and paintTileElements2 paint a different subset of the same tile
+    enum class Pass : uint8_t
+    {
+        main,
+        secondary,
+    };
+
+    enum class CallType : uint8_t
+    {
+        parent,
+        parent4FD200,
+        child,
+        trackRoad,
+        trackRoadAddition,
+        attach,
+        resetLastPS,
+        finaliseTrackRoad,
+        finaliseTrackRoadAdditions,
+    };
+
+    enum class RecordedCallFlags : uint8_t
+    {
+        none = 0U,
+        hasMaskedImage = 1U << 0,
+        hasItemType = 1U << 1,
+        hasTrackModId = 1U << 2,
+    };
+    OPENLOCO_ENABLE_ENUM_OPERATORS(RecordedCallFlags);
+
+    struct RecordedCall
+    {
+        ImageId imageId;
+        ImageId maskedImageId;
+        World::Pos3 offset; // x and y are the viewport offset for attach
+        World::Pos3 boundBoxOffset;
+        World::Pos3 boundBoxSize;
+        void* currentItem;
+        CallType type;
+        uint8_t priority;
+        Ui::ViewportInteraction::InteractionItem itemType; // Only if hasItemType otherwise the live value is used
+        uint8_t trackModId;                                // Only if hasTrackModId otherwise the live value is used
+        RecordedCallFlags flags;
+    };
+
+    // Session state that is not reset between tiles
+    enum class TileStateFlags : uint16_t
+    {
+        none = 0U,
+        itemType = 1U << 0,
+        trackModId = 1U << 1,
+        waterHeight = 1U << 2,
+        waterHeight2 = 1U << 3,
+        surfaceHeight = 1U << 4,
+        surfaceSlope = 1U << 5,
+        mergeRoadBaseImage = 1U << 6,
+        mergeRoadHeight = 1U << 7,
+    };
+    OPENLOCO_ENABLE_ENUM_OPERATORS(TileStateFlags);
+
+    struct TileState
+    {
+        Ui::ViewportInteraction::InteractionItem itemType;
+        uint8_t trackModId;
+        int16_t waterHeight;
+        int16_t waterHeight2;
+        int16_t surfaceHeight;
+        uint8_t surfaceSlope;
+        uint32_t mergeRoadBaseImage;
+        int16_t mergeRoadHeight;
+
+        // Always restored after a replay
+        void* currentItem;
+        int16_t unkVpY;
+        bool didPassSurface;
+
+        bool matches(const TileState& other, TileStateFlags fields) const;
+    };
+
+    struct Recording
+    {
+        std::vector<RecordedCall> calls;
+        TileState startState;
+        TileState endState;
+        TileStateFlags read;    // Read before being written, so must match the start state
+        TileStateFlags written; // Restored from the end state
+        bool isValid;
+    };
+
+    // Everything outside of the tile that the tile painters depend on
+    struct SessionKey
+    {
+        uint32_t generation;
+        uint8_t rotation;
+        uint8_t zoomLevel;
+        Ui::ViewportFlags viewFlags;
+        bool landscapeSmoothing;
+        bool showAiPlanningGhosts;
+        int32_t heightMarkerOffset;
+        uint16_t seaLevel;
+        CompanyId secondaryPlayer;
+        std::array<Colour, S5::Limits::kMaxCompanies + 1> companyColours;
+
+        bool operator==(const SessionKey&) const = default;
+    };
+
+    // Returns std::nullopt if a session with these options must not use the cache
+    std::optional<SessionKey> getSessionKey(const Gfx::RenderTarget& rt, const SessionOptions& options);
+
+    // Replays the recorded calls of the tile if the tile is unchanged since it was recorded.
+    // Must be called after paintTileElementsSetup, returns false if the tile must be painted.
+    bool tryReplay(PaintSession& session, World::Tile& tile, Pass pass);
+
+    // Wraps the painting of all elements of a tile that tryReplay returned false for
+    void beginRecording(PaintSession& session);
+    void endRecording(PaintSession& session, World::Tile& tile, Pass pass);
+
+    // Frees views that have not been painted recently, and the rest of the cache if it has grown too large,
+    // then allocates the entries of the view so that it can be used by the following paint.
+    // Must not be called while painting.
+    void trim(uint8_t rotation, uint8_t zoomLevel);
+
+    // Must be called whenever objects are (un)loaded as recordings refer to object data.
+    void invalidate();
+}
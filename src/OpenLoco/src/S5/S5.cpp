@@ -29,9 +29,14 @@
 #include "Ui/ProgressBar.h"
 #include "Ui/WindowManager.h"
 #include "Vehicles/OrderManager.h"
+#include "Vehicles/RoutingManager.h"
+#include "ViewportManager.h"
+#include "World/AirportMovementGraph.h"
+#include "World/CompanyAi/CompanyAiPathfinding.h"
 #include "World/CompanyManager.h"
 #include "World/IndustryManager.h"
 #include "World/StationManager.h"
+#include "World/Town.h"
 #include "World/TownManager.h"
 #include <OpenLoco/Core/Exception.hpp>
 #include <OpenLoco/Core/Stream.hpp>
@@ -187,6 +192,14 @@ namespace OpenLoco::S5
         std::memcpy(file->tileElements.data(), tileElements.data(), tileElements.size_bytes());
         removeGhostElements(file->tileElements);
 
+        for (const auto& extensionChunk : { Vehicles::RoutingManager::exportExtendedRings(), CompanyAi::exportPathfindJobs() })
+        {
+            if (!extensionChunk.empty())
+            {
+                file->extensionChunks.push_back(extensionChunk);
+            }
+        }
+
         return file;
     }
 
@@ -319,6 +332,11 @@ namespace OpenLoco::S5
                 fs.writeChunk(SawyerEncoding::runLengthMulti, file.tileElements.data(), file.tileElements.size() * sizeof(TileElement));
             }
 
+            for (const auto& extensionChunk : file.extensionChunks)
+            {
+                fs.writeChunk(SawyerEncoding::runLengthSingle, extensionChunk.data(), extensionChunk.size());
+            }
+
             fs.writeChecksum();
             return true;
         }
@@ -329,6 +347,16 @@ namespace OpenLoco::S5
         }
     }
 
+    // Extension chunks (e.g. routing rings that outgrew the routing table) follow the tile elements
+    static void readExtensionChunks(SawyerStreamReader& fs, S5File& file)
+    {
+        while (fs.hasMoreChunks())
+        {
+            auto extensionChunk = fs.readChunk();
+            file.extensionChunks.emplace_back(extensionChunk.begin(), extensionChunk.end());
+        }
+    }
+
     // 0x00441FC9
     std::unique_ptr<S5File> importSave(Stream& stream)
     {
@@ -391,6 +419,8 @@ namespace OpenLoco::S5
                 auto numTileElements = tileElements.size() / sizeof(TileElement);
                 file->tileElements.resize(numTileElements);
                 std::memcpy(file->tileElements.data(), tileElements.data(), numTileElements * sizeof(TileElement));
+
+                readExtensionChunks(fs, *file);
             }
         }
         else
@@ -419,6 +449,8 @@ namespace OpenLoco::S5
             auto numTileElements = tileElements.size() / sizeof(TileElement);
             file->tileElements.resize(numTileElements);
             std::memcpy(file->tileElements.data(), tileElements.data(), numTileElements * sizeof(TileElement));
+
+            readExtensionChunks(fs, *file);
         }
 
         return file;
@@ -452,6 +484,23 @@ namespace OpenLoco::S5
         }
     };
 
+    static std::span<const std::byte> findExtensionChunk(const S5File& file, const uint32_t magic)
+    {
+        for (const auto& extensionChunk : file.extensionChunks)
+        {
+            uint32_t chunkMagic{};
+            if (extensionChunk.size() >= sizeof(chunkMagic))
+            {
+                std::memcpy(&chunkMagic, extensionChunk.data(), sizeof(chunkMagic));
+                if (chunkMagic == magic)
+                {
+                    return extensionChunk;
+                }
+            }
+        }
+        return {};
+    }
+
     // 0x00441FA7
     bool importSaveToGameState(const fs::path& path, LoadFlags flags)
     {
@@ -620,6 +669,8 @@ namespace OpenLoco::S5
             // Copy the S5 gamestate contents to the destination gamestate, field by field
             auto& src = file->gameState;
             dst = *importGameState(src);
+            Vehicles::RoutingManager::importExtendedRings(findExtensionChunk(*file, Vehicles::RoutingManager::kExtendedRingsMagic));
+            CompanyAi::importPathfindJobs(findExtensionChunk(*file, CompanyAi::kPathfindJobsMagic));
 
             // Copy scenario options
             if (hasLoadFlags(flags, LoadFlags::scenario | LoadFlags::landscape))
@@ -651,6 +702,13 @@ namespace OpenLoco::S5
 
             Audio::stopVehicleNoise();
             EntityManager::resetSpatialIndex();
+            AirportMovementGraph::reset();
+            StationManager::resetCatchmentCoverage();
+            invalidateAllCargoAcceptance();
+            TownManager::invalidateTownGrid();
+            invalidateAllTownRoadExtents();
+            Ui::ViewportManager::invalidateLabelIndex();
+            syncIndustryStationsInRange();
             CompanyManager::updateColours();
             ObjectManager::updateTerraformObjects();
             TileManager::resetSurfaceClearance();
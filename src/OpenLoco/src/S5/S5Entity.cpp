@@ -19,6 +19,17 @@
 
 namespace OpenLoco::S5
 {
+    // Indices into rings grown past kMaxRoutingsPerVehicle are kept in the routing extension chunk
+    static uint16_t exportRoutingHandle(const Vehicles::RoutingHandle handle)
+    {
+        return static_cast<uint16_t>(handle.getVehicleRef() * Limits::kMaxRoutingsPerVehicle + handle.getIndex() % Limits::kMaxRoutingsPerVehicle);
+    }
+
+    static Vehicles::RoutingHandle importRoutingHandle(const uint16_t handle)
+    {
+        return Vehicles::RoutingHandle(handle / Limits::kMaxRoutingsPerVehicle, handle % Limits::kMaxRoutingsPerVehicle);
+    }
+
     static Entity exportNullEntity(const OpenLoco::Entity& src)
     {
         Entity dst{};
@@ -189,7 +200,7 @@ namespace OpenLoco::S5
         dstHead.tileY = src.tileY;
         dstHead.tileBaseZ = src.tileBaseZ;
         dstHead.trackType = src.trackType;
-        dstHead.routingHandle = src.routingHandle._data;
+        dstHead.routingHandle = exportRoutingHandle(src.routingHandle);
         dstHead.var_38 = enumValue(src.var_38);
         dstHead.nextCarId = enumValue(src.nextCarId);
         dstHead.var_3C = src.var_3C;
@@ -252,7 +263,7 @@ namespace OpenLoco::S5
         dstVehicle1.tileY = src.tileY;
         dstVehicle1.tileBaseZ = src.tileBaseZ;
         dstVehicle1.trackType = src.trackType;
-        dstVehicle1.routingHandle = src.routingHandle._data;
+        dstVehicle1.routingHandle = exportRoutingHandle(src.routingHandle);
         dstVehicle1.var_38 = enumValue(src.var_38);
         dstVehicle1.nextCarId = enumValue(src.nextCarId);
         dstVehicle1.var_3C = src.var_3C;
@@ -282,7 +293,7 @@ namespace OpenLoco::S5
         dstVehicle2.tileY = src.tileY;
         dstVehicle2.tileBaseZ = src.tileBaseZ;
         dstVehicle2.trackType = src.trackType;
-        dstVehicle2.routingHandle = src.routingHandle._data;
+        dstVehicle2.routingHandle = exportRoutingHandle(src.routingHandle);
         dstVehicle2.var_38 = enumValue(src.var_38);
         dstVehicle2.nextCarId = enumValue(src.nextCarId);
         dstVehicle2.var_3C = 0;
@@ -337,7 +348,7 @@ namespace OpenLoco::S5
         dstBogie.tileY = src.tileY;
         dstBogie.tileBaseZ = src.tileBaseZ;
         dstBogie.trackType = src.trackType;
-        dstBogie.routingHandle = src.routingHandle._data;
+        dstBogie.routingHandle = exportRoutingHandle(src.routingHandle);
         dstBogie.var_38 = enumValue(src.var_38);
         dstBogie.objectSpriteType = src.objectSpriteType;
         dstBogie.nextCarId = enumValue(src.nextCarId);
@@ -379,7 +390,7 @@ namespace OpenLoco::S5
         dstBody.tileY = src.tileY;
         dstBody.tileBaseZ = src.tileBaseZ;
         dstBody.trackType = src.trackType;
-        dstBody.routingHandle = src.routingHandle._data;
+        dstBody.routingHandle = exportRoutingHandle(src.routingHandle);
         dstBody.var_38 = enumValue(src.var_38);
         dstBody.objectSpriteType = src.objectSpriteType;
         dstBody.nextCarId = enumValue(src.nextCarId);
@@ -415,7 +426,7 @@ namespace OpenLoco::S5
         dstTail.tileY = src.tileY;
         dstTail.tileBaseZ = src.tileBaseZ;
         dstTail.trackType = src.trackType;
-        dstTail.routingHandle = src.routingHandle._data;
+        dstTail.routingHandle = exportRoutingHandle(src.routingHandle);
         dstTail.var_38 = enumValue(src.var_38);
         dstTail.nextCarId = enumValue(src.nextCarId);
         dstTail.var_3C = 0;
@@ -612,7 +623,7 @@ namespace OpenLoco::S5
         dst.tileY = src.tileY;
         dst.tileBaseZ = src.tileBaseZ;
         dst.trackType = src.trackType;
-        dst.routingHandle._data = src.routingHandle;
+        dst.routingHandle = importRoutingHandle(src.routingHandle);
         dst.var_38 = static_cast<Vehicles::Flags38>(src.var_38);
         dst.nextCarId = static_cast<EntityId>(src.nextCarId);
         dst.var_3C = src.var_3C;
@@ -670,7 +681,7 @@ namespace OpenLoco::S5
         dst.tileY = src.tileY;
         dst.tileBaseZ = src.tileBaseZ;
         dst.trackType = src.trackType;
-        dst.routingHandle._data = src.routingHandle;
+        dst.routingHandle = importRoutingHandle(src.routingHandle);
         dst.var_38 = static_cast<Vehicles::Flags38>(src.var_38);
         dst.nextCarId = static_cast<EntityId>(src.nextCarId);
         dst.var_3C = src.var_3C;
@@ -696,7 +707,7 @@ namespace OpenLoco::S5
         dst.tileY = src.tileY;
         dst.tileBaseZ = src.tileBaseZ;
         dst.trackType = src.trackType;
-        dst.routingHandle._data = src.routingHandle;
+        dst.routingHandle = importRoutingHandle(src.routingHandle);
         dst.var_38 = static_cast<Vehicles::Flags38>(src.var_38);
         dst.nextCarId = static_cast<EntityId>(src.nextCarId);
         dst.mode = static_cast<TransportMode>(src.mode);
@@ -745,7 +756,7 @@ namespace OpenLoco::S5
         dst.tileY = src.tileY;
         dst.tileBaseZ = src.tileBaseZ;
         dst.trackType = src.trackType;
-        dst.routingHandle._data = src.routingHandle;
+        dst.routingHandle = importRoutingHandle(src.routingHandle);
         dst.var_38 = static_cast<Vehicles::Flags38>(src.var_38);
         dst.objectSpriteType = src.objectSpriteType;
         dst.nextCarId = static_cast<EntityId>(src.nextCarId);
@@ -781,7 +792,7 @@ namespace OpenLoco::S5
         dst.tileY = src.tileY;
         dst.tileBaseZ = src.tileBaseZ;
         dst.trackType = src.trackType;
-        dst.routingHandle._data = src.routingHandle;
+        dst.routingHandle = importRoutingHandle(src.routingHandle);
         dst.var_38 = static_cast<Vehicles::Flags38>(src.var_38);
         dst.objectSpriteType = src.objectSpriteType;
         dst.nextCarId = static_cast<EntityId>(src.nextCarId);
@@ -811,7 +822,7 @@ namespace OpenLoco::S5
         dst.tileY = src.tileY;
         dst.tileBaseZ = src.tileBaseZ;
         dst.trackType = src.trackType;
-        dst.routingHandle._data = src.routingHandle;
+        dst.routingHandle = importRoutingHandle(src.routingHandle);
         dst.var_38 = static_cast<Vehicles::Flags38>(src.var_38);
         dst.nextCarId = static_cast<EntityId>(src.nextCarId);
         dst.mode = static_cast<TransportMode>(src.mode);
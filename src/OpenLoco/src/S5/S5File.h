@@ -16,5 +16,6 @@ namespace OpenLoco::S5
         GameState gameState;
         std::vector<TileElement> tileElements;
         std::vector<std::pair<ObjectHeader, std::vector<std::byte>>> packedObjects;
+        std::vector<std::vector<std::byte>> extensionChunks; // Optional chunks after the tile elements, each starts with a uint32_t magic
     };
 }
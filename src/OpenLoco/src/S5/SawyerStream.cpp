@@ -52,6 +52,11 @@ void SawyerStreamReader::read(void* data, size_t dataLen)
     }
 }
 
+bool SawyerStreamReader::hasMoreChunks() const
+{
+    return _stream.getPosition() + sizeof(uint32_t) < _stream.getLength();
+}
+
 bool SawyerStreamReader::validateChecksum()
 {
     auto valid = false;
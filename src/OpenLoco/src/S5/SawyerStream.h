@@ -36,6 +36,8 @@ namespace OpenLoco
         size_t readChunk(void* data, size_t maxDataLen);
         void read(void* data, size_t dataLen);
         bool validateChecksum();
+        // True if there is another chunk before the trailing checksum
+        bool hasMoreChunks() const;
     };
 
     class SawyerStreamWriter
@@ -78,7 +78,7 @@ namespace OpenLoco::Ui
         ostream->flush();
     }
 
-    static void saveRenderTargetToPng(const Gfx::RenderTarget& rt, std::fstream& outputStream)
+    void saveRenderTargetToPng(const Gfx::RenderTarget& rt, std::fstream& outputStream)
     {
         auto rgbaPalette = Gfx::getRgbaPalette();
 
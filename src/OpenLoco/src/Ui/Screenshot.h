@@ -1,6 +1,12 @@
 #pragma once
 
 #include <cstdint>
+#include <iosfwd>
+
+namespace OpenLoco::Gfx
+{
+    struct RenderTarget;
+}
 
 namespace OpenLoco::Ui
 {
@@ -12,4 +18,5 @@ namespace OpenLoco::Ui
 
     void triggerScreenshotCountdown(int8_t numTicks, ScreenshotType type);
     void handleScreenshotCountdown();
+    void saveRenderTargetToPng(const Gfx::RenderTarget& rt, std::fstream& outputStream);
 }
@@ -5,24 +5,26 @@
 namespace OpenLoco::Vehicles
 {
 #pragma pack(push, 1)
+    // Refers to a single routing within the routing ring of a vehicle.
+    // Rings start with kMaxRoutingsPerVehicle entries but can grow (see RoutingManager::growRing)
+    // so the index is wrapped by the capacity of the ring it refers to.
     struct RoutingHandle
     {
-        uint16_t _data;
-        constexpr RoutingHandle(const uint16_t vehicleRef, const uint8_t index)
-            : _data((vehicleRef * Limits::kMaxRoutingsPerVehicle) | index)
+        uint16_t _vehicleRef;
+        uint16_t _index;
+        constexpr RoutingHandle(const uint16_t vehicleRef, const uint16_t index)
+            : _vehicleRef(vehicleRef)
+            , _index(index)
         {
         }
 
-        constexpr uint16_t getVehicleRef() const { return _data / Limits::kMaxRoutingsPerVehicle; }
-        constexpr uint8_t getIndex() const { return _data % Limits::kMaxRoutingsPerVehicle; }
-        constexpr void setIndex(uint8_t newIndex)
-        {
-            _data &= ~(Limits::kMaxRoutingsPerVehicle - 1);
-            _data |= newIndex & (Limits::kMaxRoutingsPerVehicle - 1);
-        }
+        constexpr uint16_t getVehicleRef() const { return _vehicleRef; }
+        constexpr uint16_t getIndex() const { return _index; }
+        // Wraps newIndex by the capacity of the ring (defined in RoutingManager.cpp)
+        void setIndex(uint16_t newIndex);
 
-        bool operator==(const RoutingHandle other) const { return _data == other._data; }
+        bool operator==(const RoutingHandle other) const { return _vehicleRef == other._vehicleRef && _index == other._index; }
     };
-    static_assert(sizeof(RoutingHandle) == 2);
+    static_assert(sizeof(RoutingHandle) == 4);
 #pragma pack(pop)
 }
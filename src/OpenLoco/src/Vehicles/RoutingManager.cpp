@@ -1,11 +1,51 @@
 #include "RoutingManager.h"
+#include "Entities/EntityManager.h"
 #include "GameState.h"
+#include "Vehicle.h"
+#include "Vehicle1.h"
+#include "Vehicle2.h"
+#include "VehicleBody.h"
+#include "VehicleBogie.h"
+#include "VehicleHead.h"
+#include "VehicleManager.h"
+#include "VehicleTail.h"
+#include <OpenLoco/Core/Exception.hpp>
+#include <OpenLoco/Core/MemoryStream.h>
+#include <OpenLoco/Diagnostics/Logging.h>
 #include <algorithm>
+#include <array>
+#include <bit>
+
+using namespace OpenLoco::Diagnostics;
+
+namespace OpenLoco::Vehicles
+{
+    void RoutingHandle::setIndex(uint16_t newIndex)
+    {
+        _index = newIndex & (RoutingManager::getRingCapacity(_vehicleRef) - 1);
+    }
+}
 
 namespace OpenLoco::Vehicles::RoutingManager
 {
+    // Rings that have outgrown their row of the routing table. Empty when the vehicle
+    // is still using the routing table in the GameState.
+    static std::array<std::vector<uint16_t>, Limits::kMaxVehicles> _extendedRings;
+
     static auto& routings() { return getGameState().routings; }
 
+    static uint16_t* getRing(const uint16_t vehicleRef)
+    {
+        auto& extendedRing = _extendedRings[vehicleRef];
+        return extendedRing.empty() ? routings()[vehicleRef] : extendedRing.data();
+    }
+
+    uint16_t getRingCapacity(const uint16_t vehicleRef)
+    {
+        const auto& extendedRing = _extendedRings[vehicleRef];
+        return extendedRing.empty() ? Limits::kMaxRoutingsPerVehicle : static_cast<uint16_t>(extendedRing.size());
+    }
+
     static std::optional<uint16_t> findFreeRoutingVehicleRef()
     {
         const auto& routingArr = routings();
@@ -19,8 +59,8 @@ namespace OpenLoco::Vehicles::RoutingManager
 
     void resetRoutings(const RoutingHandle handle)
     {
-        auto& vehRoutingArr = routings()[handle.getVehicleRef()];
-        std::fill(std::begin(vehRoutingArr), std::end(vehRoutingArr), kAllocatedButFreeRouting);
+        const auto vehicleRef = handle.getVehicleRef();
+        std::fill_n(getRing(vehicleRef), getRingCapacity(vehicleRef), kAllocatedButFreeRouting);
     }
 
     bool isEmptyRoutingSlotAvailable()
@@ -36,6 +76,7 @@ namespace OpenLoco::Vehicles::RoutingManager
         {
             auto& vehRoutingArr = routings()[*vehicleRef];
             std::fill(std::begin(vehRoutingArr), std::end(vehRoutingArr), kAllocatedButFreeRouting);
+            _extendedRings[*vehicleRef] = {};
             return { RoutingHandle(*vehicleRef, 0) };
         }
         return std::nullopt;
@@ -43,12 +84,12 @@ namespace OpenLoco::Vehicles::RoutingManager
 
     uint16_t getRouting(const RoutingHandle handle)
     {
-        return routings()[handle.getVehicleRef()][handle.getIndex()];
+        return getRing(handle.getVehicleRef())[handle.getIndex()];
     }
 
     void setRouting(const RoutingHandle handle, uint16_t routing)
     {
-        routings()[handle.getVehicleRef()][handle.getIndex()] = routing;
+        getRing(handle.getVehicleRef())[handle.getIndex()] = routing;
     }
 
     void freeRouting(const RoutingHandle handle)
@@ -61,20 +102,168 @@ namespace OpenLoco::Vehicles::RoutingManager
     {
         auto& vehRoutingArr = routings()[handle.getVehicleRef()];
         std::fill(std::begin(vehRoutingArr), std::end(vehRoutingArr), kRoutingNull);
+        _extendedRings[handle.getVehicleRef()] = {};
     }
 
     // 0x004A8810
     void resetRoutingTable()
     {
         std::fill_n(&routings()[0][0], Limits::kMaxVehicles * Limits::kMaxRoutingsPerVehicle, kRoutingNull);
+        for (auto& extendedRing : _extendedRings)
+        {
+            extendedRing = {};
+        }
+    }
+
+    bool growRing(const RoutingHandle oldestHandle)
+    {
+        const auto vehicleRef = oldestHandle.getVehicleRef();
+        const auto oldCapacity = getRingCapacity(vehicleRef);
+        if (oldCapacity >= kMaxRoutingsPerRing)
+        {
+            return false;
+        }
+
+        // Everything from the oldest routing to the end of the old ring keeps its index
+        // and everything before it is moved to directly follow on from the old ring.
+        const auto* oldRing = getRing(vehicleRef);
+        const auto oldest = oldestHandle.getIndex();
+        std::vector<uint16_t> newRing(oldCapacity * 2, kAllocatedButFreeRouting);
+        std::copy(oldRing + oldest, oldRing + oldCapacity, newRing.begin() + oldest);
+        std::copy(oldRing, oldRing + oldest, newRing.begin() + oldCapacity);
+
+        // Keep the routing table row allocated (but empty) so that it is not handed out to another vehicle
+        auto& vehRoutingArr = routings()[vehicleRef];
+        std::fill(std::begin(vehRoutingArr), std::end(vehRoutingArr), kAllocatedButFreeRouting);
+
+        _extendedRings[vehicleRef] = std::move(newRing);
+        return true;
+    }
+
+    RoutingHandle getGrownHandle(const RoutingHandle handle, const RoutingHandle oldestHandle, const uint16_t oldCapacity)
+    {
+        if (handle.getIndex() < oldestHandle.getIndex())
+        {
+            return RoutingHandle(handle.getVehicleRef(), handle.getIndex() + oldCapacity);
+        }
+        return handle;
+    }
+
+    // Chunk layout:
+    //   uint32_t magic, uint16_t numRings
+    //   numRings * { uint16_t vehicleRef, uint16_t capacity, uint16_t routings[capacity] }
+    //   uint16_t numComponents
+    //   numComponents * { EntityId id, uint16_t index }
+    std::vector<std::byte> exportExtendedRings()
+    {
+        const auto numRings = std::count_if(std::begin(_extendedRings), std::end(_extendedRings), [](const auto& ring) { return !ring.empty(); });
+        if (numRings == 0)
+        {
+            return {};
+        }
+
+        MemoryStream ms;
+        ms.writeValue(kExtendedRingsMagic);
+        ms.writeValue(static_cast<uint16_t>(numRings));
+        for (auto vehicleRef = 0U; vehicleRef < Limits::kMaxVehicles; ++vehicleRef)
+        {
+            const auto& ring = _extendedRings[vehicleRef];
+            if (ring.empty())
+            {
+                continue;
+            }
+            ms.writeValue(static_cast<uint16_t>(vehicleRef));
+            ms.writeValue(static_cast<uint16_t>(ring.size()));
+            ms.write(ring.data(), ring.size() * sizeof(uint16_t));
+        }
+
+        // The S5 entities can only store indices below kMaxRoutingsPerVehicle so store the full ones here
+        std::vector<std::pair<EntityId, uint16_t>> componentIndices;
+        for (auto* head : VehicleManager::VehicleList())
+        {
+            if (_extendedRings[head->routingHandle.getVehicleRef()].empty())
+            {
+                continue;
+            }
+            Vehicle train(*head);
+            train.applyToComponents([&componentIndices](auto& component) {
+                componentIndices.emplace_back(component.id, component.routingHandle.getIndex());
+            });
+        }
+        ms.writeValue(static_cast<uint16_t>(componentIndices.size()));
+        for (const auto& [id, index] : componentIndices)
+        {
+            ms.writeValue(id);
+            ms.writeValue(index);
+        }
+
+        const auto span = ms.getSpan();
+        return std::vector<std::byte>(span.begin(), span.end());
+    }
+
+    void importExtendedRings(std::span<const std::byte> data)
+    {
+        for (auto& extendedRing : _extendedRings)
+        {
+            extendedRing = {};
+        }
+        if (data.empty())
+        {
+            return;
+        }
+
+        MemoryStream ms;
+        ms.write(data.data(), data.size());
+        ms.setPosition(0);
+        try
+        {
+            if (ms.readValue<uint32_t>() != kExtendedRingsMagic)
+            {
+                Logging::warn("Ignoring unknown routing extension chunk");
+                return;
+            }
+            const auto numRings = ms.readValue<uint16_t>();
+            for (auto i = 0U; i < numRings; ++i)
+            {
+                const auto vehicleRef = ms.readValue<uint16_t>();
+                const auto capacity = ms.readValue<uint16_t>();
+                if (vehicleRef >= Limits::kMaxVehicles || capacity > kMaxRoutingsPerRing || !std::has_single_bit(capacity) || capacity <= Limits::kMaxRoutingsPerVehicle)
+                {
+                    throw Exception::RuntimeError("Invalid routing ring");
+                }
+                auto& ring = _extendedRings[vehicleRef];
+                ring.resize(capacity);
+                ms.read(ring.data(), capacity * sizeof(uint16_t));
+            }
+
+            const auto numComponents = ms.readValue<uint16_t>();
+            for (auto i = 0U; i < numComponents; ++i)
+            {
+                const auto id = ms.readValue<EntityId>();
+                const auto index = ms.readValue<uint16_t>();
+                auto* component = EntityManager::get<VehicleBase>(id);
+                if (component == nullptr)
+                {
+                    continue;
+                }
+                const auto vehicleRef = component->routingHandle.getVehicleRef();
+                component->routingHandle = RoutingHandle(vehicleRef, index & (getRingCapacity(vehicleRef) - 1));
+            }
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to read routing extension: {}", e.what());
+        }
     }
 
     RingView::Iterator::Iterator(const RoutingHandle& begin, bool isEnd, Direction direction)
         : _current(begin)
+        , _ring(getRing(begin.getVehicleRef()))
+        , _mask(getRingCapacity(begin.getVehicleRef()) - 1)
         , _isEnd(isEnd)
         , _direction(direction)
     {
-        if (routings()[_current.getVehicleRef()][_current.getIndex()] == kAllocatedButFreeRouting)
+        if (_ring[_current.getIndex()] == kAllocatedButFreeRouting)
         {
             _hasLooped = true;
         }
@@ -86,7 +275,7 @@ namespace OpenLoco::Vehicles::RoutingManager
         {
             return --*this;
         }
-        _current.setIndex((_current.getIndex() + 1) & 0x3F);
+        _current = RoutingHandle(_current.getVehicleRef(), (_current.getIndex() + 1) & _mask);
 
         if (_current.getIndex() == 0)
         {
@@ -97,9 +286,9 @@ namespace OpenLoco::Vehicles::RoutingManager
 
     RingView::Iterator& RingView::Iterator::operator--()
     {
-        _current.setIndex((_current.getIndex() - 1) & 0x3F);
+        _current = RoutingHandle(_current.getVehicleRef(), (_current.getIndex() - 1) & _mask);
 
-        if (_current.getIndex() == 0x3F)
+        if (_current.getIndex() == _mask)
         {
             _hasLooped = true;
         }
@@ -115,11 +304,11 @@ namespace OpenLoco::Vehicles::RoutingManager
         // If this is an end iterator then its value is implied to be kAllocatedButFreeRouting
         if (_isEnd)
         {
-            return routings()[other._current.getVehicleRef()][other._current.getIndex()] == kAllocatedButFreeRouting;
+            return other._ring[other._current.getIndex()] == kAllocatedButFreeRouting;
         }
         if (other._isEnd)
         {
-            return routings()[_current.getVehicleRef()][_current.getIndex()] == kAllocatedButFreeRouting;
+            return _ring[_current.getIndex()] == kAllocatedButFreeRouting;
         }
         return false;
     }
@@ -2,8 +2,10 @@
 
 #include "Routing.h"
 
+#include <cstddef>
 #include <iterator>
 #include <optional>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -12,6 +14,7 @@ namespace OpenLoco::Vehicles::RoutingManager
 {
     constexpr uint16_t kAllocatedButFreeRouting = 0xFFFEU; // Indicates that this array entry is allocated to a vehicle but no routing has been set.
     constexpr uint16_t kRoutingNull = 0xFFFFU;             // Indicates that this array entry is unallocated to any vehicle.
+    constexpr uint16_t kMaxRoutingsPerRing = 1024;         // Rings start at kMaxRoutingsPerVehicle and are doubled up to this size.
 
     std::optional<RoutingHandle> getAndAllocateFreeRoutingHandle();
     void freeRoutingHandle(const RoutingHandle handle);
@@ -25,6 +28,22 @@ namespace OpenLoco::Vehicles::RoutingManager
     bool isEmptyRoutingSlotAvailable();
     void resetRoutingTable();
 
+    // Capacity is always a power of two
+    uint16_t getRingCapacity(const uint16_t vehicleRef);
+    // Doubles the capacity of the vehicle's ring. The ring is unrolled so that it is contiguous
+    // from oldestHandle (the routing of the tail) onwards. Any handles into the ring must then be
+    // updated with getGrownHandle. Returns false if the ring is already at kMaxRoutingsPerRing.
+    bool growRing(const RoutingHandle oldestHandle);
+    RoutingHandle getGrownHandle(const RoutingHandle handle, const RoutingHandle oldestHandle, const uint16_t oldCapacity);
+
+    // Rings larger than kMaxRoutingsPerVehicle do not fit in the S5 routing table so are saved
+    // as an extension chunk. Importing must happen after the entities have been loaded.
+    // Builds that do not read the chunk (including vanilla) see an empty routing table row for these
+    // vehicles, so they lose all of their pending routings and have to find their route again.
+    constexpr uint32_t kExtendedRingsMagic = 0x58474E52; // "RNGX"
+    std::vector<std::byte> exportExtendedRings();
+    void importExtendedRings(std::span<const std::byte> data);
+
     struct RingView
     {
     private:
@@ -38,6 +57,8 @@ namespace OpenLoco::Vehicles::RoutingManager
 
         private:
             RoutingHandle _current;
+            const uint16_t* _ring;
+            uint16_t _mask;
             bool _hasLooped = false;
             bool _isEnd = false;
             Direction _direction = Direction::forward;
@@ -16,6 +16,7 @@
 #include "VehicleHead.h"
 #include "VehicleTail.h"
 #include "ViewportManager.h"
+#include <OpenLoco/Core/Exception.hpp>
 
 using namespace OpenLoco::Literals;
 
@@ -298,17 +299,23 @@ namespace OpenLoco::Vehicles
                     continue;
                 }
 
-                // Perhaps a little expensive to do this (we don't do it on rail vehicles for example)
-                Vehicle train(vehicleTail->head);
-                if (train.veh1->var_3C < 0x220C0)
+                // Only the front of the other train is needed so avoid walking all of its cars
+                auto* otherHead = EntityManager::get<VehicleHead>(vehicleTail->head);
+                auto* otherVeh1 = otherHead != nullptr ? EntityManager::get<Vehicle1>(otherHead->nextCarId) : nullptr;
+                auto* otherVeh2 = otherVeh1 != nullptr ? EntityManager::get<Vehicle2>(otherVeh1->nextCarId) : nullptr;
+                if (otherVeh2 == nullptr)
+                {
+                    throw Exception::RuntimeError("Bad vehicle structure");
+                }
+                if (otherVeh1->var_3C < 0x220C0)
                 {
                     continue;
                 }
-                if ((train.veh2->var_73 & Flags73::isBrokenDown) != Flags73::none)
+                if ((otherVeh2->var_73 & Flags73::isBrokenDown) != Flags73::none)
                 {
                     continue;
                 }
-                if (veh1.var_3C < train.veh1->var_3C)
+                if (veh1.var_3C < otherVeh1->var_3C)
                 {
                     return OvertakeResult::mayBeOvertaken;
                 }
@@ -317,7 +324,7 @@ namespace OpenLoco::Vehicles
                 {
                     continue;
                 }
-                if (veh2->maxSpeed <= train.veh2->maxSpeed)
+                if (veh2->maxSpeed <= otherVeh2->maxSpeed)
                 {
                     return OvertakeResult::mayBeOvertaken;
                 }
@@ -47,6 +47,7 @@
 #include "VehicleManager.h"
 #include "VehicleTail.h"
 #include "ViewportManager.h"
+#include "World/AirportMovementGraph.h"
 #include "World/CompanyManager.h"
 #include "World/CompanyRecords.h"
 #include "World/IndustryManager.h"
@@ -58,6 +59,7 @@
 #include <cassert>
 #include <numeric>
 #include <optional>
+#include <sfl/small_vector.hpp>
 
 using namespace OpenLoco::Literals;
 using namespace OpenLoco::World;
@@ -1740,59 +1742,18 @@ namespace OpenLoco::Vehicles
     // 0x00426E26
     static std::pair<AirportMovementNodeFlags, World::Pos3> airportGetMovementEdgeTarget(StationId targetStation, uint8_t curEdge)
     {
-        auto station = StationManager::get(targetStation);
-
-        Pos3 stationLoc = station->airportStartPos;
-
-        auto tile = TileManager::get(stationLoc);
-
-        for (auto& el : tile)
+        const auto* graph = AirportMovementGraph::get(targetStation);
+        if (graph == nullptr)
         {
-            auto* elStation = el.as<StationElement>();
-            if (elStation == nullptr)
-            {
-                continue;
-            }
-
-            if (elStation->baseZ() != stationLoc.z / 4)
-            {
-                continue;
-            }
-
-            auto airportObject = ObjectManager::get<AirportObject>(elStation->objectId());
-            const auto movementNodes = airportObject->getMovementNodes();
-            const auto movementEdges = airportObject->getMovementEdges();
-
-            auto destinationNode = movementEdges[curEdge].nextNode;
-
-            Pos2 loc2 = {
-                static_cast<int16_t>(movementNodes[destinationNode].x - 16),
-                static_cast<int16_t>(movementNodes[destinationNode].y - 16)
-            };
-            loc2 = Math::Vector::rotate(loc2, elStation->rotation());
-            auto airportMovement = movementNodes[destinationNode];
-
-            loc2.x += 16 + stationLoc.x;
-            loc2.y += 16 + stationLoc.y;
-
-            Pos3 loc = { loc2.x, loc2.y, static_cast<int16_t>(movementNodes[destinationNode].z + stationLoc.z) };
-
-            if (!airportMovement.hasFlags(AirportMovementNodeFlags::taxiing))
-            {
-                loc.z = stationLoc.z + 255;
-                if (!airportMovement.hasFlags(AirportMovementNodeFlags::inFlight))
-                {
-                    loc.z = 960;
-                }
-            }
-
-            return std::make_pair(airportMovement.flags, loc);
+            // Tile not found. Todo: fail gracefully
+            assert(false);
+            // Flags, location
+            return std::make_pair(AirportMovementNodeFlags::none, World::Pos3{ 0, 0, 0 });
         }
 
-        // Tile not found. Todo: fail gracefully
-        assert(false);
-        // Flags, location
-        return std::make_pair(AirportMovementNodeFlags::none, World::Pos3{ 0, 0, 0 });
+        const auto& airportObject = graph->getAirportObject();
+        const auto destinationNode = airportObject.getMovementEdges()[curEdge].nextNode;
+        return std::make_pair(airportObject.getMovementNodes()[destinationNode].flags, graph->nodeLocs[destinationNode]);
     }
 
     // 0x004A9051
@@ -2036,76 +1997,60 @@ namespace OpenLoco::Vehicles
             return std::make_pair(Status::travelling, targetSpeed);
         }
 
-        auto station = StationManager::get(stationId);
-
-        Pos3 loc = station->airportStartPos;
-
-        auto tile = World::TileManager::get(loc);
-        for (auto& el : tile)
+        const auto* graph = AirportMovementGraph::get(stationId);
+        if (graph == nullptr)
         {
-            auto* elStation = el.as<World::StationElement>();
-            if (elStation == nullptr)
-            {
-                continue;
-            }
-
-            if (elStation->baseZ() != loc.z / 4)
-            {
-                continue;
-            }
+            // Tile not found. Todo: fail gracefully
+            assert(false);
+            return std::make_pair(Status::travelling, train.veh2->maxSpeed);
+        }
 
-            auto airportObject = ObjectManager::get<AirportObject>(elStation->objectId());
-            const auto movementEdges = airportObject->getMovementEdges();
+        const auto movementEdges = graph->getAirportObject().getMovementEdges();
 
-            uint8_t al = movementEdges[airportMovementEdge].var_03;
-            uint8_t cl = movementEdges[airportMovementEdge].var_00;
+        uint8_t al = movementEdges[airportMovementEdge].var_03;
+        uint8_t cl = movementEdges[airportMovementEdge].var_00;
 
-            auto veh2 = train.veh2;
-            if (al != 0)
+        auto veh2 = train.veh2;
+        if (al != 0)
+        {
+            if (cl == 1 || al != 2)
             {
-                if (cl == 1 || al != 2)
+                if (al == 1)
                 {
-                    if (al == 1)
-                    {
-                        return std::make_pair(Status::landing, veh2->rackRailMaxSpeed);
-                    }
-                    else if (al == 3)
-                    {
-                        return std::make_pair(Status::landing, 0_mph);
-                    }
-                    else if (al == 4)
-                    {
-                        return std::make_pair(Status::taxiing1, 20_mph);
-                    }
-                    else
-                    {
-                        return std::make_pair(Status::approaching, veh2->rackRailMaxSpeed);
-                    }
+                    return std::make_pair(Status::landing, veh2->rackRailMaxSpeed);
                 }
-            }
-
-            if (cl == 2)
-            {
-                auto targetSpeed = veh2->maxSpeed;
-                if (veh2->has73Flags(Flags73::isBrokenDown))
+                else if (al == 3)
                 {
-                    targetSpeed = veh2->rackRailMaxSpeed;
+                    return std::make_pair(Status::landing, 0_mph);
+                }
+                else if (al == 4)
+                {
+                    return std::make_pair(Status::taxiing1, 20_mph);
+                }
+                else
+                {
+                    return std::make_pair(Status::approaching, veh2->rackRailMaxSpeed);
                 }
-                return std::make_pair(Status::takingOff, targetSpeed);
-            }
-            else if (cl == 3)
-            {
-                return std::make_pair(Status::takingOff, 0_mph);
             }
-            else
+        }
+
+        if (cl == 2)
+        {
+            auto targetSpeed = veh2->maxSpeed;
+            if (veh2->has73Flags(Flags73::isBrokenDown))
             {
-                return std::make_pair(Status::taxiing2, 20_mph);
+                targetSpeed = veh2->rackRailMaxSpeed;
             }
+            return std::make_pair(Status::takingOff, targetSpeed);
+        }
+        else if (cl == 3)
+        {
+            return std::make_pair(Status::takingOff, 0_mph);
+        }
+        else
+        {
+            return std::make_pair(Status::taxiing2, 20_mph);
         }
-
-        // Tile not found. Todo: fail gracefully
-        assert(false);
-        return std::make_pair(Status::travelling, train.veh2->maxSpeed);
     }
 
     // 0x004A95CB
@@ -2505,144 +2450,76 @@ namespace OpenLoco::Vehicles
     {
         auto station = StationManager::get(stationId);
 
-        Pos3 loc = station->airportStartPos;
+        const auto* graph = AirportMovementGraph::get(stationId);
+        if (graph == nullptr)
+        {
+            // Tile not found. Todo: fail gracefully
+            assert(false);
+            return kAirportMovementNodeNull;
+        }
 
-        auto tile = TileManager::get(loc);
+        const auto& airportObject = graph->getAirportObject();
+        const auto movementNodes = airportObject.getMovementNodes();
+        const auto movementEdges = airportObject.getMovementEdges();
 
-        for (auto& el : tile)
-        {
-            auto* elStation = el.as<StationElement>();
-            if (elStation == nullptr)
+        auto isEdgeClear = [station](const AirportObject::MovementEdge& transition) {
+            if (station->airportMovementOccupiedEdges & transition.mustBeClearEdges)
             {
-                continue;
+                return false;
             }
 
-            if (elStation->baseZ() != loc.z / 4)
+            if (transition.atLeastOneClearEdges == 0)
             {
-                continue;
+                return true;
             }
 
-            auto airportObject = ObjectManager::get<AirportObject>(elStation->objectId());
-            const auto movementNodes = airportObject->getMovementNodes();
-            const auto movementEdges = airportObject->getMovementEdges();
+            auto occupiedAreas = station->airportMovementOccupiedEdges & transition.atLeastOneClearEdges;
+            return occupiedAreas != transition.atLeastOneClearEdges;
+        };
 
-            if (curEdge == kAirportMovementNodeNull)
+        if (curEdge == kAirportMovementNodeNull)
+        {
+            for (uint8_t movementEdge = 0; movementEdge < airportObject.numMovementEdges; movementEdge++)
             {
-                for (uint8_t movementEdge = 0; movementEdge < airportObject->numMovementEdges; movementEdge++)
+                const auto& transition = movementEdges[movementEdge];
+                if (!movementNodes[transition.curNode].hasFlags(AirportMovementNodeFlags::flag2))
                 {
-                    const auto& transition = movementEdges[movementEdge];
-                    if (!movementNodes[transition.curNode].hasFlags(AirportMovementNodeFlags::flag2))
-                    {
-                        continue;
-                    }
-
-                    if (station->airportMovementOccupiedEdges & transition.mustBeClearEdges)
-                    {
-                        continue;
-                    }
-
-                    if (transition.atLeastOneClearEdges == 0)
-                    {
-                        return movementEdge;
-                    }
-
-                    auto occupiedAreas = station->airportMovementOccupiedEdges & transition.atLeastOneClearEdges;
-                    if (occupiedAreas == transition.atLeastOneClearEdges)
-                    {
-                        continue;
-                    }
+                    continue;
+                }
 
+                if (isEdgeClear(transition))
+                {
                     return movementEdge;
                 }
-                return kAirportMovementNoValidEdge;
             }
-            else
-            {
-                uint8_t targetNode = movementEdges[curEdge].nextNode;
-                if (status == Status::takingOff && movementNodes[targetNode].hasFlags(AirportMovementNodeFlags::takeoffEnd))
-                {
-                    return kAirportMovementNodeNull;
-                }
-                // 0x4272A5
-                Vehicle train(head);
-                auto vehObject = ObjectManager::get<VehicleObject>(train.cars.firstCar.front->objectId);
-                if (vehObject->hasFlags(VehicleObjectFlags::aircraftIsHelicopter))
-                {
-                    for (uint8_t movementEdge = 0; movementEdge < airportObject->numMovementEdges; movementEdge++)
-                    {
-                        const auto& transition = movementEdges[movementEdge];
-
-                        if (transition.curNode != targetNode)
-                        {
-                            continue;
-                        }
-
-                        if (movementNodes[transition.nextNode].hasFlags(AirportMovementNodeFlags::takeoffBegin))
-                        {
-                            continue;
-                        }
-
-                        if (station->airportMovementOccupiedEdges & transition.mustBeClearEdges)
-                        {
-                            continue;
-                        }
-
-                        if (transition.atLeastOneClearEdges == 0)
-                        {
-                            return movementEdge;
-                        }
-
-                        auto occupiedAreas = station->airportMovementOccupiedEdges & transition.atLeastOneClearEdges;
-                        if (occupiedAreas == transition.atLeastOneClearEdges)
-                        {
-                            continue;
-                        }
-                        return movementEdge;
-                    }
-
-                    return kAirportMovementNoValidEdge;
-                }
-                else
-                {
-                    for (uint8_t movementEdge = 0; movementEdge < airportObject->numMovementEdges; movementEdge++)
-                    {
-                        const auto& transition = movementEdges[movementEdge];
-                        if (transition.curNode != targetNode)
-                        {
-                            continue;
-                        }
-
-                        if (movementNodes[transition.nextNode].hasFlags(AirportMovementNodeFlags::heliTakeoffBegin))
-                        {
-                            continue;
-                        }
-
-                        if (station->airportMovementOccupiedEdges & transition.mustBeClearEdges)
-                        {
-                            continue;
-                        }
+            return kAirportMovementNoValidEdge;
+        }
 
-                        if (transition.atLeastOneClearEdges == 0)
-                        {
-                            return movementEdge;
-                        }
+        uint8_t targetNode = movementEdges[curEdge].nextNode;
+        if (status == Status::takingOff && movementNodes[targetNode].hasFlags(AirportMovementNodeFlags::takeoffEnd))
+        {
+            return kAirportMovementNodeNull;
+        }
+        // 0x4272A5
+        Vehicle train(head);
+        auto vehObject = ObjectManager::get<VehicleObject>(train.cars.firstCar.front->objectId);
+        // Helicopters must not use the plane take off runway and vice versa
+        const auto excludedTakeoffFlag = vehObject->hasFlags(VehicleObjectFlags::aircraftIsHelicopter) ? AirportMovementNodeFlags::takeoffBegin : AirportMovementNodeFlags::heliTakeoffBegin;
 
-                        auto occupiedAreas = station->airportMovementOccupiedEdges & transition.atLeastOneClearEdges;
-                        if (occupiedAreas == transition.atLeastOneClearEdges)
-                        {
-                            continue;
-                        }
+        for (const auto movementEdge : graph->getEdgesFrom(targetNode))
+        {
+            const auto& transition = movementEdges[movementEdge];
+            if (movementNodes[transition.nextNode].hasFlags(excludedTakeoffFlag))
+            {
+                continue;
+            }
 
-                        return movementEdge;
-                    }
-                    return kAirportMovementNoValidEdge;
-                }
+            if (isEdgeClear(transition))
+            {
+                return movementEdge;
             }
         }
-
-        // Tile not found. Todo: fail gracefully
-        assert(false);
-        return kAirportMovementNodeNull;
+        return kAirportMovementNoValidEdge;
     }
 
     // 0x004B980A
@@ -4187,6 +4064,47 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x0047DA8D
+    static bool isRoutingSpaceAhead(const VehicleHead& head)
+    {
+        auto routings = RoutingManager::RingView(head.routingHandle);
+        auto iter = routings.begin();
+        iter++;
+        iter++;
+        if (RoutingManager::getRouting(*iter) != RoutingManager::kAllocatedButFreeRouting)
+        {
+            return false;
+        }
+        return RoutingManager::getRouting(*++iter) == RoutingManager::kAllocatedButFreeRouting;
+    }
+
+    // Grows the routing ring of the train and moves every component onto the grown ring
+    static bool growRoutingRing(VehicleHead& head)
+    {
+        Vehicle train(head);
+        // The tail holds the oldest routing still in use
+        const auto oldestHandle = train.tail->routingHandle;
+        const auto oldCapacity = RoutingManager::getRingCapacity(oldestHandle.getVehicleRef());
+        if (!RoutingManager::growRing(oldestHandle))
+        {
+            return false;
+        }
+        train.applyToComponents([&oldestHandle, oldCapacity](auto& component) {
+            component.routingHandle = RoutingManager::getGrownHandle(component.routingHandle, oldestHandle, oldCapacity);
+        });
+        return true;
+    }
+
+    // When the head catches up with the tail in the routing ring the ring is full. Rather than
+    // stopping the train (as vanilla did for trains longer than the ring) the ring is grown.
+    static bool ensureRoutingSpaceAhead(VehicleHead& head)
+    {
+        if (isRoutingSpaceAhead(head))
+        {
+            return true;
+        }
+        return growRoutingRing(head) && isRoutingSpaceAhead(head);
+    }
+
     static Sub4ACEE7Result sub_47DA8D(VehicleHead& head, uint32_t unk1, uint32_t var_113612C)
     {
         // ROAD only
@@ -4194,19 +4112,9 @@ namespace OpenLoco::Vehicles
         // 0x0112C30C
         const auto compatibleStations = calculateCompatibleRoadStations(head);
 
+        if (!ensureRoutingSpaceAhead(head))
         {
-            auto routings = RoutingManager::RingView(head.routingHandle);
-            auto iter = routings.begin();
-            iter++;
-            iter++;
-            if (RoutingManager::getRouting(*iter) != RoutingManager::kAllocatedButFreeRouting)
-            {
-                return Sub4ACEE7Result{ 1, 0, StationId::null };
-            }
-            if (RoutingManager::getRouting(*++iter) != RoutingManager::kAllocatedButFreeRouting)
-            {
-                return Sub4ACEE7Result{ 1, 0, StationId::null };
-            }
+            return Sub4ACEE7Result{ 1, 0, StationId::null };
         }
 
         UpdateMotionResult motionResult{};
@@ -4432,19 +4340,9 @@ namespace OpenLoco::Vehicles
         // TRACK only
 
         // Identical to ROAD
+        if (!ensureRoutingSpaceAhead(head))
         {
-            auto routings = RoutingManager::RingView(head.routingHandle);
-            auto iter = routings.begin();
-            iter++;
-            iter++;
-            if (RoutingManager::getRouting(*iter) != RoutingManager::kAllocatedButFreeRouting)
-            {
-                return Sub4ACEE7Result{ 1, 0, StationId::null };
-            }
-            if (RoutingManager::getRouting(*++iter) != RoutingManager::kAllocatedButFreeRouting)
-            {
-                return Sub4ACEE7Result{ 1, 0, StationId::null };
-            }
+            return Sub4ACEE7Result{ 1, 0, StationId::null };
         }
 
         // Identical to ROAD
@@ -6409,14 +6307,14 @@ namespace OpenLoco::Vehicles
             // Routings are back to front with regard to walking the length of the train
             // that is why we copy in reverse order
             // copy all the routings from underneath the train (veh2.routingHandle to tail.routingHandle in reverse)
-            sfl::static_vector<uint16_t, 64> copiedRoutings{};
+            sfl::small_vector<uint16_t, Limits::kMaxRoutingsPerVehicle> copiedRoutings{};
             {
                 auto iterHandle = train.veh2->routingHandle;
                 auto endHandle = train.tail->routingHandle;
                 while (iterHandle.getIndex() != endHandle.getIndex())
                 {
                     copiedRoutings.push_back(RoutingManager::getRouting(iterHandle));
-                    iterHandle.setIndex((iterHandle.getIndex() - 1) & 0x3F);
+                    iterHandle.setIndex(iterHandle.getIndex() - 1);
                 }
                 copiedRoutings.push_back(RoutingManager::getRouting(iterHandle));
             }
@@ -6469,14 +6367,14 @@ namespace OpenLoco::Vehicles
             // Routings are back to front with regard to walking the length of the train
             // that is why we copy in reverse order
             // copy all the routings from underneath the train (veh2.routingHandle to tail.routingHandle in reverse)
-            sfl::static_vector<uint16_t, 64> copiedRoutings{};
+            sfl::small_vector<uint16_t, Limits::kMaxRoutingsPerVehicle> copiedRoutings{};
             {
                 auto iterHandle = train.veh2->routingHandle;
                 auto endHandle = train.tail->routingHandle;
                 while (iterHandle.getIndex() != endHandle.getIndex())
                 {
                     copiedRoutings.push_back(RoutingManager::getRouting(iterHandle));
-                    iterHandle.setIndex((iterHandle.getIndex() - 1) & 0x3F);
+                    iterHandle.setIndex(iterHandle.getIndex() - 1);
                 }
                 copiedRoutings.push_back(RoutingManager::getRouting(iterHandle));
             }
@@ -12,6 +12,7 @@
 #include "Map/Tile.h"
 #include "Map/TileManager.h"
 #include "Paint/Paint.h"
+#include "Paint/TilePaintCache.h"
 #include "SceneManager.h"
 #include "Ui/ViewportInteraction.h"
 #include "Ui/Window.h"
@@ -19,16 +20,52 @@
 #include "Vehicles/OrderManager.h"
 #include "Vehicles/Orders.h"
 #include "Vehicles/VehicleManager.h"
+#include "ViewportManager.h"
 #include "World/CompanyManager.h"
 #include "World/StationManager.h"
 #include "World/TownManager.h"
 
+#include <atomic>
 #include <execution>
 
 using namespace OpenLoco::World;
 
 namespace OpenLoco::Ui
 {
+    static bool _paintStatsEnabled = false;
+    static std::atomic<uint32_t> _paintStatsColumns = 0;
+    static std::atomic<int64_t> _paintStatsGenerate = 0;
+    static std::atomic<int64_t> _paintStatsArrange = 0;
+    static std::atomic<int64_t> _paintStatsDraw = 0;
+
+    ViewportPaintStats getViewportPaintStats()
+    {
+        return ViewportPaintStats{
+            _paintStatsColumns.load(std::memory_order_relaxed),
+            std::chrono::nanoseconds(_paintStatsGenerate.load(std::memory_order_relaxed)),
+            std::chrono::nanoseconds(_paintStatsArrange.load(std::memory_order_relaxed)),
+            std::chrono::nanoseconds(_paintStatsDraw.load(std::memory_order_relaxed)),
+        };
+    }
+
+    void resetViewportPaintStats()
+    {
+        _paintStatsColumns = 0;
+        _paintStatsGenerate = 0;
+        _paintStatsArrange = 0;
+        _paintStatsDraw = 0;
+    }
+
+    void setViewportPaintStatsEnabled(bool enabled)
+    {
+        _paintStatsEnabled = enabled;
+    }
+
+    static void addPaintStatsDuration(std::atomic<int64_t>& stat, std::chrono::high_resolution_clock::duration duration)
+    {
+        stat.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count(), std::memory_order_relaxed);
+    }
+
     int Viewport::getRotation() const
     {
         return WindowManager::getCurrentRotation(); // Eventually this should become a variable of the viewport
@@ -69,9 +106,11 @@ namespace OpenLoco::Ui
 
         drawingCtx.pushRenderTarget(unZoomedRt);
 
-        for (const auto& station : StationManager::stations())
+        const auto drawableRect = unZoomedRt.getDrawableRect();
+        for (const auto stationId : ViewportManager::getStationLabels(rt.zoomLevel, drawableRect.left(), drawableRect.right()))
         {
-            if ((station.flags & StationFlags::flag_5) != StationFlags::none)
+            const auto& station = *StationManager::get(stationId);
+            if (station.empty() || (station.flags & StationFlags::flag_5) != StationFlags::none)
             {
                 continue;
             }
@@ -99,8 +138,14 @@ namespace OpenLoco::Ui
 
         drawingCtx.pushRenderTarget(unZoomedRt);
 
-        for (auto& town : TownManager::towns())
+        const auto drawableRect = unZoomedRt.getDrawableRect();
+        for (const auto townId : ViewportManager::getTownLabels(rt.zoomLevel, drawableRect.left(), drawableRect.right()))
         {
+            auto& town = *TownManager::get(townId);
+            if (town.empty())
+            {
+                continue;
+            }
             town.drawLabel(drawingCtx, rt);
         }
 
@@ -208,6 +253,9 @@ namespace OpenLoco::Ui
         // Drawing is performed in columns of 32 pixels (1 tile wide)
         sfl::small_vector<Gfx::RenderTarget, 512> columns;
 
+        Paint::TilePaintCache::trim(options.rotation, zoom);
+        ViewportManager::updateLabelIndex();
+
         // Generate and sort columns.
         for (auto columnX = alignedX; columnX < rightBorder; columnX += 32)
         {
@@ -234,15 +282,31 @@ namespace OpenLoco::Ui
             columns.push_back(columnRt);
         }
 
+        const bool collectStats = _paintStatsEnabled;
         std::for_each(std::execution::par, columns.begin(), columns.end(), [&](const auto& columnRt) {
             // TODO: This bypasses the interface currently, needs refactoring to create a new drawing context per thread.
             Gfx::SoftwareDrawingContext columnDrawingCtx;
             columnDrawingCtx.pushRenderTarget(columnRt);
 
             columnDrawingCtx.clearSingle(fillColour);
+            std::chrono::high_resolution_clock::time_point timeStarted;
+            std::chrono::high_resolution_clock::time_point timeGenerated;
+            std::chrono::high_resolution_clock::time_point timeArranged;
+            if (collectStats)
+            {
+                timeStarted = std::chrono::high_resolution_clock::now();
+            }
             auto sess = Paint::PaintSession(columnRt, options);
             sess.generate();
+            if (collectStats)
+            {
+                timeGenerated = std::chrono::high_resolution_clock::now();
+            }
             sess.arrangeStructs();
+            if (collectStats)
+            {
+                timeArranged = std::chrono::high_resolution_clock::now();
+            }
             sess.drawStructs(columnDrawingCtx);
             // Climate code used to draw here.
 
@@ -263,6 +327,14 @@ namespace OpenLoco::Ui
 
             sess.drawStringStructs(columnDrawingCtx);
             drawRoutingNumbers(columnDrawingCtx);
+
+            if (collectStats)
+            {
+                _paintStatsColumns.fetch_add(1, std::memory_order_relaxed);
+                addPaintStatsDuration(_paintStatsGenerate, timeGenerated - timeStarted);
+                addPaintStatsDuration(_paintStatsArrange, timeArranged - timeGenerated);
+                addPaintStatsDuration(_paintStatsDraw, std::chrono::high_resolution_clock::now() - timeArranged);
+            }
         });
     }
 
@@ -6,6 +6,7 @@
 #include <OpenLoco/Core/EnumFlags.hpp>
 #include <OpenLoco/Engine/World.hpp>
 #include <algorithm>
+#include <chrono>
 
 namespace OpenLoco::Gfx
 {
@@ -39,7 +40,7 @@ namespace OpenLoco::Ui
         int32_t bottom = 0;
         int32_t right = 0;
 
-        constexpr bool contains(const viewport_pos& vpos)
+        constexpr bool contains(const viewport_pos& vpos) const
         {
             return (left < vpos.x && top < vpos.y && right >= vpos.x && bottom >= vpos.y);
         }
@@ -196,6 +197,20 @@ namespace OpenLoco::Ui
         void paint(Gfx::DrawingContext& drawingCtx, const Ui::Rect& rect);
     };
 
+    // Accumulated cost of the columns painted by Viewport::paint while enabled, used by the render command.
+    // Columns are painted in parallel so the durations add up to more than the time taken.
+    struct ViewportPaintStats
+    {
+        uint32_t numColumns;
+        std::chrono::nanoseconds generate;
+        std::chrono::nanoseconds arrange;
+        std::chrono::nanoseconds draw; // Including labels
+    };
+
+    ViewportPaintStats getViewportPaintStats();
+    void resetViewportPaintStats();
+    void setViewportPaintStatsEnabled(bool enabled);
+
     struct ViewportConfig
     {
         EntityId viewportTargetSprite; // 0x0
@@ -9,6 +9,8 @@
 #include "Ui/Window.h"
 #include "Ui/WindowManager.h"
 #include "World/Station.h"
+#include "World/StationManager.h"
+#include "World/TownManager.h"
 
 #include <algorithm>
 #include <cassert>
@@ -322,4 +324,111 @@ namespace OpenLoco::Ui::ViewportManager
 
         invalidate(rect, zoom);
     }
+
+    // Width of the label index buckets in label frame coordinates. Viewports are drawn in columns
+    // 32 pixels wide so a column always fits in one bucket at any zoom level.
+    static constexpr int32_t kLabelBucketShift = 5;
+    static constexpr int32_t kLabelBucketWidth = 1 << kLabelBucketShift;
+
+    template<typename TId>
+    struct LabelBuckets
+    {
+        int32_t firstBucket = 0;
+        std::vector<std::vector<TId>> buckets;
+        std::vector<TId> all;
+
+        void clear()
+        {
+            firstBucket = 0;
+            buckets.clear();
+            all.clear();
+        }
+
+        // Bucket b holds every label where left <= (b + 1) * width and right >= b * width
+        void add(TId id, const LabelFrame& frame, uint8_t zoom)
+        {
+            all.push_back(id);
+
+            const auto first = (frame.left[zoom] - 1) >> kLabelBucketShift;
+            const auto last = frame.right[zoom] >> kLabelBucketShift;
+            if (buckets.empty())
+            {
+                firstBucket = first;
+            }
+            else if (first < firstBucket)
+            {
+                buckets.insert(buckets.begin(), firstBucket - first, {});
+                firstBucket = first;
+            }
+            if (last - firstBucket >= static_cast<int32_t>(buckets.size()))
+            {
+                buckets.resize(last - firstBucket + 1);
+            }
+            for (auto bucket = first; bucket <= last; ++bucket)
+            {
+                buckets[bucket - firstBucket].push_back(id);
+            }
+        }
+
+        std::span<const TId> get(int32_t left, int32_t right) const
+        {
+            const auto bucket = left >> kLabelBucketShift;
+            if (right > (bucket + 1) * kLabelBucketWidth)
+            {
+                // Spans multiple buckets
+                return all;
+            }
+            const auto index = bucket - firstBucket;
+            if (index < 0 || index >= static_cast<int32_t>(buckets.size()))
+            {
+                return {};
+            }
+            return buckets[index];
+        }
+    };
+
+    static std::array<LabelBuckets<StationId>, ZoomLevel::max> _stationLabels;
+    static std::array<LabelBuckets<TownId>, ZoomLevel::max> _townLabels;
+    static bool _labelIndexIsValid = false;
+
+    void invalidateLabelIndex()
+    {
+        _labelIndexIsValid = false;
+    }
+
+    void updateLabelIndex()
+    {
+        if (_labelIndexIsValid)
+        {
+            return;
+        }
+
+        for (uint8_t zoom = 0; zoom < ZoomLevel::max; ++zoom)
+        {
+            auto& stationLabels = _stationLabels[zoom];
+            stationLabels.clear();
+            for (const auto& station : StationManager::stations())
+            {
+                stationLabels.add(station.id(), station.labelFrame, zoom);
+            }
+
+            auto& townLabels = _townLabels[zoom];
+            townLabels.clear();
+            for (const auto& town : TownManager::towns())
+            {
+                townLabels.add(town.id(), town.labelFrame, zoom);
+            }
+        }
+        _labelIndexIsValid = true;
+    }
+
+    std::span<const StationId> getStationLabels(uint8_t zoom, int32_t left, int32_t right)
+    {
+        return _stationLabels[zoom].get(left, right);
+    }
+
+    std::span<const TownId> getTownLabels(uint8_t zoom, int32_t left, int32_t right)
+    {
+        return _townLabels[zoom].get(left, right);
+    }
 }
@@ -6,6 +6,7 @@
 #include "Ui/Window.h"
 #include "World/Station.h"
 #include <array>
+#include <span>
 
 namespace OpenLoco::Ui::ViewportManager
 {
@@ -19,4 +20,14 @@ namespace OpenLoco::Ui::ViewportManager
     void invalidate(Station* station);
     void invalidate(EntityBase* t, ZoomLevel zoom);
     void invalidate(World::Pos2 pos, coord_t zMin, coord_t zMax, ZoomLevel zoom = ZoomLevel::eighth, int radius = 32);
+
+    // Station and town labels are looked up by their screen position when drawn. The index must be
+    // invalidated whenever a label frame changes or a station or town is added.
+    void invalidateLabelIndex();
+    // Rebuilds the label index if it has been invalidated, must not be called while drawing.
+    void updateLabelIndex();
+    // Returns in ascending id order at least every station or town that has a label at the zoom
+    // level within the horizontal range [left, right] of label frame coordinates.
+    std::span<const StationId> getStationLabels(uint8_t zoom, int32_t left, int32_t right);
+    std::span<const TownId> getTownLabels(uint8_t zoom, int32_t left, int32_t right);
 }
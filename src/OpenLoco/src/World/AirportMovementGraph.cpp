@@ -0,0 +1,123 @@
+#include "AirportMovementGraph.h"
+#include "Engine/Limits.h"
+#include "Map/StationElement.h"
+#include "Map/TileManager.h"
+#include "Objects/AirportObject.h"
+#include "Objects/ObjectManager.h"
+#include "StationManager.h"
+#include <OpenLoco/Math/Vector.hpp>
+#include <array>
+#include <optional>
+
+namespace OpenLoco::AirportMovementGraph
+{
+    static std::array<std::optional<Graph>, Limits::kMaxStations> _graphs;
+
+    const AirportObject& Graph::getAirportObject() const
+    {
+        return *ObjectManager::get<AirportObject>(objectId);
+    }
+
+    static const World::StationElement* findAirportElement(const World::Pos3& airportStartPos)
+    {
+        auto tile = World::TileManager::get(airportStartPos);
+        for (auto& el : tile)
+        {
+            auto* elStation = el.as<World::StationElement>();
+            if (elStation == nullptr)
+            {
+                continue;
+            }
+
+            if (elStation->baseZ() != airportStartPos.z / 4)
+            {
+                continue;
+            }
+            return elStation;
+        }
+        return nullptr;
+    }
+
+    // 0x00426D52, 0x00426E26
+    static World::Pos3 getNodeLoc(const AirportObject::MovementNode& movementNode, const World::Pos3& airportStartPos, const uint8_t rotation)
+    {
+        auto nodeOffset = Math::Vector::rotate(World::Pos2(movementNode.x, movementNode.y) - World::Pos2(16, 16), rotation) + World::Pos2(16, 16);
+        auto nodeLoc = World::Pos3{ nodeOffset.x, nodeOffset.y, movementNode.z } + airportStartPos;
+        if (!movementNode.hasFlags(AirportMovementNodeFlags::taxiing))
+        {
+            nodeLoc.z = airportStartPos.z + 255;
+            if (!movementNode.hasFlags(AirportMovementNodeFlags::inFlight))
+            {
+                nodeLoc.z = 30 * 32;
+            }
+        }
+        return nodeLoc;
+    }
+
+    static std::optional<Graph> buildGraph(const World::Pos3& airportStartPos)
+    {
+        const auto* elStation = findAirportElement(airportStartPos);
+        if (elStation == nullptr)
+        {
+            return std::nullopt;
+        }
+
+        Graph graph{};
+        graph.airportStartPos = airportStartPos;
+        graph.objectId = elStation->objectId();
+        graph.rotation = elStation->rotation();
+
+        const auto& airportObj = graph.getAirportObject();
+        const auto movementNodes = airportObj.getMovementNodes();
+        const auto movementEdges = airportObj.getMovementEdges();
+
+        graph.nodeLocs.reserve(movementNodes.size());
+        for (const auto& movementNode : movementNodes)
+        {
+            graph.nodeLocs.push_back(getNodeLoc(movementNode, airportStartPos, graph.rotation));
+        }
+
+        graph.edgesFromNode.resize(movementNodes.size());
+        for (uint8_t movementEdge = 0; movementEdge < movementEdges.size(); ++movementEdge)
+        {
+            const auto curNode = movementEdges[movementEdge].curNode;
+            if (curNode < graph.edgesFromNode.size())
+            {
+                graph.edgesFromNode[curNode].push_back(movementEdge);
+            }
+        }
+        return graph;
+    }
+
+    const Graph* get(const StationId stationId)
+    {
+        auto* station = StationManager::get(stationId);
+        if (station == nullptr)
+        {
+            return nullptr;
+        }
+
+        auto& graph = _graphs[enumValue(stationId)];
+        if (!graph.has_value() || graph->airportStartPos != station->airportStartPos)
+        {
+            graph = buildGraph(station->airportStartPos);
+        }
+        return graph.has_value() ? &*graph : nullptr;
+    }
+
+    void invalidate(const StationId stationId)
+    {
+        if (enumValue(stationId) < _graphs.size())
+        {
+            _graphs[enumValue(stationId)] = std::nullopt;
+        }
+    }
+
+    void reset()
+    {
+        for (auto& graph : _graphs)
+        {
+            graph = std::nullopt;
+        }
+    }
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Map/Tile.h"
+#include "Types.hpp"
+#include <span>
+#include <vector>
+
+namespace OpenLoco
+{
+    struct AirportObject;
+}
+
+namespace OpenLoco::AirportMovementGraph
+{
+    // The movement nodes and edges of a station's airport object with the station's position
+    // and rotation applied. Built on first use and kept until the airport is changed.
+    struct Graph
+    {
+        World::Pos3 airportStartPos;
+        uint8_t objectId;
+        uint8_t rotation;
+        std::vector<World::Pos3> nodeLocs;               // World position of each movement node
+        std::vector<std::vector<uint8_t>> edgesFromNode; // Movement edges (ascending) whose curNode is the node
+
+        const AirportObject& getAirportObject() const;
+        std::span<const uint8_t> getEdgesFrom(uint8_t node) const { return edgesFromNode[node]; }
+    };
+
+    // Returns nullptr if the station does not have an airport
+    const Graph* get(StationId stationId);
+    void invalidate(StationId stationId);
+    void reset();
+}
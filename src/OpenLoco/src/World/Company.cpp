@@ -23,6 +23,7 @@
 #include "Random.h"
 #include "Scenario/ScenarioManager.h"
 #include "SceneManager.h"
+#include "Station.h"
 #include "StationManager.h"
 #include "TownManager.h"
 #include "Ui/WindowManager.h"
@@ -34,6 +35,7 @@
 #include "Vehicles/VehicleManager.h"
 #include "ViewportManager.h"
 #include <OpenLoco/Core/Numerics.hpp>
+#include <OpenLoco/Diagnostics/Logging.h>
 #include <OpenLoco/Math/Bound.hpp>
 #include <algorithm>
 #include <array>
@@ -527,32 +529,86 @@ namespace OpenLoco
         setHeadquartersVariation(getHeadquarterPerformanceVariation());
     }
 
-    // 0x00437C8C
-    static int16_t calculatePerformanceIndex(const Company& company)
+    static void addToVehicleTotals(CompanyVehicleTotals& totals, Vehicles::VehicleHead& head)
     {
-        if ((company.challengeFlags & CompanyFlags::bankrupt) != CompanyFlags::none)
+        Vehicles::Vehicle train(head);
+
+        // Unsure why >> 1, /2
+        // Note: To match vanilla using >> 1. Use /2 when diverging allowed.
+        currency32_t performanceProfit = train.veh2->totalRecentProfit() >> 1;
+        if (static_cast<int64_t>(totals.performanceProfit) + performanceProfit < std::numeric_limits<currency32_t>::max())
         {
-            return 0;
+            totals.performanceProfit += performanceProfit;
         }
 
-        currency32_t totalProfit = 0;
-        for (auto head : VehicleManager::VehicleList())
+        if (head.has38Flags(Vehicles::Flags38::isGhost))
         {
-            if (head->owner != company.id())
+            return;
+        }
+
+        currency32_t trainProfit = train.veh2->totalRecentProfit();
+        // Unsure why >>2, /4
+        // Note: To match vanilla using >> 2. Use /4 when diverging allowed.
+        totals.vehicleProfit += trainProfit >> 2;
+
+        totals.vehicleValue += trainProfit * 8;
+
+        for (auto& car : train.cars)
+        {
+            totals.vehicleValue += car.front->refundCost;
+        }
+    }
+
+#ifndef NDEBUG
+    // Cross checks the single walk against walking the vehicles once per company like vanilla
+    static void verifyCompanyVehicleTotals(const std::array<CompanyVehicleTotals, Limits::kMaxCompanies>& totals)
+    {
+        for (const auto& company : CompanyManager::companies())
+        {
+            CompanyVehicleTotals reference{};
+            for (auto head : VehicleManager::VehicleList())
             {
-                continue;
+                if (head->owner == company.id())
+                {
+                    addToVehicleTotals(reference, *head);
+                }
+            }
+            const auto& total = totals[enumValue(company.id())];
+            if (total.performanceProfit != reference.performanceProfit || total.vehicleProfit != reference.vehicleProfit || total.vehicleValue != reference.vehicleValue)
+            {
+                Diagnostics::Logging::error("Company {} has mismatched vehicle totals", enumValue(company.id()));
             }
+        }
+    }
+#endif
 
-            Vehicles::Vehicle train(*head);
-            // Unsure why >> 1, /2
-            // Note: To match vanilla using >> 1. Use /2 when diverging allowed.
-            currency32_t trainProfit = train.veh2->totalRecentProfit() >> 1;
-            if (static_cast<int64_t>(totalProfit) + trainProfit < std::numeric_limits<currency32_t>::max())
+    // Totals for every company from a single walk of the vehicles rather than one walk per company
+    std::array<CompanyVehicleTotals, Limits::kMaxCompanies> calculateCompanyVehicleTotals()
+    {
+        std::array<CompanyVehicleTotals, Limits::kMaxCompanies> totals{};
+        for (auto head : VehicleManager::VehicleList())
+        {
+            if (enumValue(head->owner) >= Limits::kMaxCompanies)
             {
-                totalProfit += trainProfit;
+                continue;
             }
+            addToVehicleTotals(totals[enumValue(head->owner)], *head);
         }
-        totalProfit = std::max(0, totalProfit);
+#ifndef NDEBUG
+        verifyCompanyVehicleTotals(totals);
+#endif
+        return totals;
+    }
+
+    // 0x00437C8C
+    static int16_t calculatePerformanceIndex(const Company& company, const CompanyVehicleTotals& vehicleTotals)
+    {
+        if ((company.challengeFlags & CompanyFlags::bankrupt) != CompanyFlags::none)
+        {
+            return 0;
+        }
+
+        const currency32_t totalProfit = std::max(0, vehicleTotals.performanceProfit);
 
         const auto partialProfitFactor = Math::Vector::fastSquareRoot(totalProfit) * 75;
         const auto ecoFactor = Math::Vector::fastSquareRoot(Economy::getCurrencyMultiplicationFactor(0));
@@ -567,8 +623,7 @@ namespace OpenLoco
         return profitFactor + cargoFactor;
     }
 
-    // 0x00437D79
-    ProfitAndValue calculateCompanyValue(const Company& company)
+    static ProfitAndValue calculateCompanyValue(const Company& company, const CompanyVehicleTotals& vehicleTotals)
     {
         if ((company.challengeFlags & CompanyFlags::bankrupt) != CompanyFlags::none)
         {
@@ -577,34 +632,24 @@ namespace OpenLoco
 
         currency48_t totalValue = company.cash;
         totalValue -= company.currentLoan;
+        totalValue += vehicleTotals.vehicleValue;
+        totalValue = std::max<currency48_t>(0, totalValue);
+        return { vehicleTotals.vehicleProfit, totalValue };
+    }
 
-        currency48_t totalVehicleProfit = 0;
+    // 0x00437D79
+    ProfitAndValue calculateCompanyValue(const Company& company)
+    {
+        CompanyVehicleTotals vehicleTotals{};
         for (auto head : VehicleManager::VehicleList())
         {
             if (head->owner != company.id())
             {
                 continue;
             }
-            if (head->has38Flags(Vehicles::Flags38::isGhost))
-            {
-                continue;
-            }
-
-            Vehicles::Vehicle train(*head);
-            currency32_t trainProfit = train.veh2->totalRecentProfit();
-            // Unsure why >>2, /4
-            // Note: To match vanilla using >> 2. Use /4 when diverging allowed.
-            totalVehicleProfit += trainProfit >> 2;
-
-            totalValue += trainProfit * 8;
-
-            for (auto& car : train.cars)
-            {
-                totalValue += car.front->refundCost;
-            }
+            addToVehicleTotals(vehicleTotals, *head);
         }
-        totalValue = std::max<currency48_t>(0, totalValue);
-        return { totalVehicleProfit, totalValue };
+        return calculateCompanyValue(company, vehicleTotals);
     }
 
     // 0x004389CC
@@ -634,7 +679,7 @@ namespace OpenLoco
         GameCommands::setUpdatingCompanyId(prevUpdateCompany);
     }
 
-    void Company::updateMonthly1()
+    void Company::updateMonthly1(const CompanyVehicleTotals& vehicleTotals)
     {
         std::rotate(std::begin(cargoUnitsDeliveredHistory), std::end(cargoUnitsDeliveredHistory) - 1, std::end(cargoUnitsDeliveredHistory));
         cargoUnitsDeliveredHistory[0] = cargoUnitsTotalDelivered;
@@ -656,7 +701,7 @@ namespace OpenLoco
             }
         }
 
-        const auto newPerformance = calculatePerformanceIndex(*this);
+        const auto newPerformance = calculatePerformanceIndex(*this, vehicleTotals);
         challengeFlags &= ~(CompanyFlags::increasedPerformance | CompanyFlags::decreasedPerformance);
         if (newPerformance != performanceIndex)
         {
@@ -694,7 +739,7 @@ namespace OpenLoco
             companyEmotionEvent(id(), Emotion::scared);
         }
 
-        const auto newValue = calculateCompanyValue(*this);
+        const auto newValue = calculateCompanyValue(*this, vehicleTotals);
         std::rotate(std::begin(companyValueHistory), std::end(companyValueHistory) - 1, std::end(companyValueHistory));
         companyValueHistory[0] = newValue.companyValue;
         vehicleProfit = newValue.vehicleProfit;
@@ -992,6 +1037,7 @@ namespace OpenLoco
             elBuilding->setAge(0);
             elBuilding->setConstructed(false);
             elBuilding->setUnk5u(0);
+            invalidateCargoAcceptance(pos);
 
             Ui::ViewportManager::invalidate(World::toWorldSpace(pos), elBuilding->baseHeight(), elBuilding->clearHeight());
 
@@ -8,6 +8,7 @@
 #include <OpenLoco/Core/BitSet.hpp>
 #include <OpenLoco/Core/EnumFlags.hpp>
 #include <OpenLoco/Engine/World.hpp>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
@@ -139,6 +140,14 @@ namespace OpenLoco
 
     constexpr size_t kExpenditureHistoryCapacity = 16;
 
+    // Totals over the vehicles of a company used by the monthly performance and value calculations
+    struct CompanyVehicleTotals
+    {
+        currency32_t performanceProfit;
+        currency48_t vehicleProfit;
+        currency48_t vehicleValue;
+    };
+
     struct Company
     {
         struct Unk25C0HashTableEntry
@@ -276,7 +285,7 @@ namespace OpenLoco
         void evaluateChallengeProgress();
         void updateDailyControllingPlayer();
         void updateMonthlyHeadquarters();
-        void updateMonthly1();
+        void updateMonthly1(const CompanyVehicleTotals& vehicleTotals);
         void updateLoanAutorepay();
         void updateQuarterly();
         void updateVehicleColours();
@@ -315,4 +324,5 @@ namespace OpenLoco
 
     // 0x00437D79
     ProfitAndValue calculateCompanyValue(const Company& company);
+    std::array<CompanyVehicleTotals, Limits::kMaxCompanies> calculateCompanyVehicleTotals();
 }
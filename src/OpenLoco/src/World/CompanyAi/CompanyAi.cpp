@@ -7665,6 +7665,29 @@ namespace OpenLoco
         aiThinkEndCompany,
     };
 
+    static bool _aiThinkStatsEnabled = false;
+    static std::array<AiThinkStats, Limits::kMaxCompanies> _aiThinkStats;
+
+    AiThinkStats& getAiThinkStats(const CompanyId id)
+    {
+        return _aiThinkStats[enumValue(id)];
+    }
+
+    void resetAiThinkStats()
+    {
+        _aiThinkStats.fill({});
+    }
+
+    void setAiThinkStatsEnabled(bool enabled)
+    {
+        _aiThinkStatsEnabled = enabled;
+    }
+
+    bool isAiThinkStatsEnabled()
+    {
+        return _aiThinkStatsEnabled;
+    }
+
     // 0x00430762
     void aiThink(const CompanyId id)
     {
@@ -4,6 +4,7 @@
 #include "Types.hpp"
 #include <OpenLoco/Core/EnumFlags.hpp>
 #include <OpenLoco/Engine/World.hpp>
+#include <chrono>
 
 namespace OpenLoco
 {
@@ -128,7 +129,19 @@ namespace OpenLoco
         World::Pos2 getDestinationPositionB() const;
     };
 
+    // Accumulated cost of aiThink for a company while enabled, used by the AI benchmark
+    struct AiThinkStats
+    {
+        uint32_t numThinks;
+        std::chrono::nanoseconds duration;
+        uint32_t numGameCommands;
+    };
+
     void aiThink(CompanyId id);
+    AiThinkStats& getAiThinkStats(CompanyId id);
+    void resetAiThinkStats();
+    void setAiThinkStatsEnabled(bool enabled);
+    bool isAiThinkStatsEnabled();
 
     void setAiObservation(CompanyId id);
     void removeEntityFromThought(AiThought& thought, EntityId id);
@@ -1,6 +1,7 @@
 #include "CompanyAiPathfinding.h"
 #include "CompanyAi.h"
 #include "Economy/Economy.h"
+#include "Engine/Limits.h"
 #include "GameCommands/CompanyAi/AiTrackReplacement.h"
 #include "GameCommands/Road/CreateRoad.h"
 #include "GameCommands/Road/RemoveRoad.h"
@@ -28,6 +29,15 @@
 #include "Objects/TreeObject.h"
 #include "World/Company.h"
 #include "World/Station.h"
+#include <OpenLoco/Core/Exception.hpp>
+#include <OpenLoco/Core/MemoryStream.h>
+#include <OpenLoco/Diagnostics/Logging.h>
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <unordered_map>
+
+using namespace OpenLoco::Diagnostics;
 
 namespace OpenLoco::CompanyAi
 {
@@ -317,6 +327,99 @@ namespace OpenLoco::CompanyAi
         uint32_t bridgeWeighting;               // 0x0112C37C
     };
 
+    struct PlacementQueryKey
+    {
+        World::Pos3 pos;
+        uint8_t trackRoadId;
+        uint8_t rotation;
+        uint8_t trackRoadObjId;
+        uint8_t bridge;
+        uint8_t unkFlags;
+
+        bool operator==(const PlacementQueryKey&) const = default;
+    };
+
+    struct PlacementQueryKeyHash
+    {
+        size_t operator()(const PlacementQueryKey& key) const
+        {
+            const auto posHash = (static_cast<uint64_t>(static_cast<uint16_t>(key.pos.x)) << 32) | (static_cast<uint64_t>(static_cast<uint16_t>(key.pos.y)) << 16) | static_cast<uint16_t>(key.pos.z);
+            const auto argsHash = (static_cast<uint64_t>(key.trackRoadId) << 32) | (key.rotation << 24) | (key.trackRoadObjId << 16) | (key.bridge << 8) | key.unkFlags;
+            return std::hash<uint64_t>{}(posHash ^ (argsHash * 0x9E3779B97F4A7C15ULL));
+        }
+    };
+
+    struct PlacementQueryResult
+    {
+        bool isValid;
+        uint8_t flags;        // returnState.flags_1136073
+        uint8_t bridgeHeight; // returnState.byte_1136074
+    };
+
+    // The placement score searches try every combination of pieces so the same piece is reached
+    // via many different routes. Nothing is built during a section search so the result of
+    // querying a piece can be reused until the search finishes.
+    static std::unordered_map<PlacementQueryKey, PlacementQueryResult, PlacementQueryKeyHash> _placementQueryCache;
+
+    static void clearPlacementQueryCache()
+    {
+        _placementQueryCache.clear();
+    }
+
+    static PlacementQueryResult queryTrackPlacement(const GameCommands::TrackPlacementArgs& args)
+    {
+        const auto key = PlacementQueryKey{ args.pos, args.trackId, args.rotation, args.trackObjectId, args.bridge, args.unkFlags };
+        if (auto res = _placementQueryCache.find(key); res != _placementQueryCache.end())
+        {
+            return res->second;
+        }
+
+        auto regs = static_cast<GameCommands::registers>(args);
+        regs.bl = GameCommands::Flags::aiAllocated | GameCommands::Flags::noPayment;
+        GameCommands::createTrack(regs);
+
+        const auto& returnState = GameCommands::getLegacyReturnState();
+        const auto result = PlacementQueryResult{ static_cast<uint32_t>(regs.ebx) != GameCommands::FAILURE, returnState.flags_1136073, returnState.byte_1136074 };
+        _placementQueryCache.emplace(key, result);
+        return result;
+    }
+
+    static PlacementQueryResult queryRoadPlacement(GameCommands::RoadPlacementArgs args)
+    {
+        const auto key = PlacementQueryKey{ args.pos, args.roadId, args.rotation, args.roadObjectId, args.bridge, args.unkFlags };
+        if (auto res = _placementQueryCache.find(key); res != _placementQueryCache.end())
+        {
+            return res->second;
+        }
+
+        auto& returnState = GameCommands::getLegacyReturnState();
+        auto result = PlacementQueryResult{ true, 0, 0 };
+
+        auto regs = static_cast<GameCommands::registers>(args);
+        regs.bl = GameCommands::Flags::aiAllocated | GameCommands::Flags::noPayment;
+        GameCommands::createRoad(regs);
+        if (static_cast<uint32_t>(regs.ebx) == GameCommands::FAILURE)
+        {
+            if ((_createTrackRoadCommandAiUnkFlags & (1U << 20)) && returnState.alternateRoadObjectId != 0xFFU)
+            {
+                args.roadObjectId = returnState.alternateRoadObjectId;
+            }
+            if (returnState.byte_1136075 != 0xFFU)
+            {
+                args.bridge = returnState.byte_1136075;
+            }
+            regs = static_cast<GameCommands::registers>(args);
+            regs.bl = GameCommands::Flags::aiAllocated | GameCommands::Flags::noPayment;
+            GameCommands::createRoad(regs);
+            result.isValid = static_cast<uint32_t>(regs.ebx) != GameCommands::FAILURE;
+        }
+        result.flags = returnState.flags_1136073;
+        result.bridgeHeight = returnState.byte_1136074;
+
+        _placementQueryCache.emplace(key, result);
+        return result;
+    }
+
     // 0x004854B2
     // pos : ax, cx, dl
     // tad : bp
@@ -393,30 +496,23 @@ namespace OpenLoco::CompanyAi
         args.unk = false;
         args.unkFlags = _createTrackRoadCommandAiUnkFlags >> 20;
 
+        const auto placement = queryTrackPlacement(args);
+        if (!placement.isValid)
         {
-            auto regs = static_cast<GameCommands::registers>(args);
-            regs.bl = GameCommands::Flags::aiAllocated | GameCommands::Flags::noPayment;
-            GameCommands::createTrack(regs);
-            if (static_cast<uint32_t>(regs.ebx) == GameCommands::FAILURE)
-            {
-                return;
-            }
+            return;
         }
 
         totalResult.flags |= (1U << 0);
         state.currentWeighting += World::TrackData::getTrackMiscData(trackId).unkWeighting;
 
-        auto& returnState = GameCommands::getLegacyReturnState();
-
         // Place track attempt required a bridge
-        if (returnState.flags_1136073 & (1U << 0))
+        if (placement.flags & (1U << 0))
         {
-            // returnState.byte_1136074 is the bridge height
-            const auto unkFactor = (returnState.byte_1136074 * World::TrackData::getTrackMiscData(trackId).unkWeighting) / 2;
+            const auto unkFactor = (placement.bridgeHeight * World::TrackData::getTrackMiscData(trackId).unkWeighting) / 2;
             state.bridgeWeighting += unkFactor;
         }
         // Place track attempt requires removing a building
-        if (returnState.flags_1136073 & (1U << 4))
+        if (placement.flags & (1U << 4))
         {
             state.numBuildingsRequiredDestroyed++;
         }
@@ -533,51 +629,30 @@ namespace OpenLoco::CompanyAi
         args.mods = 0;
         args.unkFlags = _createTrackRoadCommandAiUnkFlags >> 16;
 
-        auto& returnState = GameCommands::getLegacyReturnState();
-
+        const auto placement = queryRoadPlacement(args);
+        if (!placement.isValid)
         {
-            auto regs = static_cast<GameCommands::registers>(args);
-            regs.bl = GameCommands::Flags::aiAllocated | GameCommands::Flags::noPayment;
-            GameCommands::createRoad(regs);
-            if (static_cast<uint32_t>(regs.ebx) == GameCommands::FAILURE)
-            {
-                if ((_createTrackRoadCommandAiUnkFlags & (1U << 20)) && returnState.alternateRoadObjectId != 0xFFU)
-                {
-                    args.roadObjectId = returnState.alternateRoadObjectId;
-                }
-                if (returnState.byte_1136075 != 0xFFU)
-                {
-                    args.bridge = returnState.byte_1136075;
-                }
-                regs = static_cast<GameCommands::registers>(args);
-                regs.bl = GameCommands::Flags::aiAllocated | GameCommands::Flags::noPayment;
-                GameCommands::createRoad(regs);
-                if (static_cast<uint32_t>(regs.ebx) == GameCommands::FAILURE)
-                {
-                    return;
-                }
-            }
+            return;
         }
 
         totalResult.flags |= (1U << 0);
         auto placementWeighting = World::TrackData::getRoadMiscData(roadId).unkWeighting;
 
         // Place road attempt overlayed an existing road
-        if (returnState.flags_1136073 & (1U << 5))
+        if (placement.flags & (1U << 5))
         {
             placementWeighting -= placementWeighting / 4;
         }
         state.currentWeighting += placementWeighting;
 
         // Place road attempt required a bridge
-        if (returnState.flags_1136073 & (1U << 0))
+        if (placement.flags & (1U << 0))
         {
-            // returnState.byte_1136074 is the bridge height
-            const auto unkFactor = (returnState.byte_1136074 * placementWeighting) / 2;
+            const auto unkFactor = (placement.bridgeHeight * placementWeighting) / 2;
             state.bridgeWeighting += unkFactor;
         }
         // Place road attempt requires removing a building
-        if (returnState.flags_1136073 & (1U << 4))
+        if (placement.flags & (1U << 4))
         {
             state.numBuildingsRequiredDestroyed++;
         }
@@ -817,6 +892,8 @@ namespace OpenLoco::CompanyAi
                 const auto newTad = (trackId << 3) | rotation;
                 placementResults.push_back(std::make_pair(trackId, queryTrackPlacementScore(company, pos, newTad, diagFlag, placementVars)));
             }
+            // The chosen track is about to be placed which invalidates the queried placements
+            clearPlacementQueryCache();
             // 0x00484813
             uint16_t bestMinScore = 0xFFFFU;
             uint16_t bestMinWeighting = 0xFFFFU;
@@ -1064,6 +1141,8 @@ namespace OpenLoco::CompanyAi
                 const auto newTad = (roadId << 3) | rotation;
                 placementResults.push_back(std::make_pair(roadId, queryRoadPlacementScore(company, pos, newTad, placementVars)));
             }
+            // The chosen road is about to be placed which invalidates the queried placements
+            clearPlacementQueryCache();
             // 0x00484EF0
             uint16_t bestMinScore = 0xFFFFU;
             uint16_t bestMinWeighting = 0xFFFFU;
@@ -2132,7 +2211,51 @@ namespace OpenLoco::CompanyAi
         uint32_t totalWeighting;    // 0x0112C36C
     };
 
-    // 0x00485B75
+    // Walking the route from the search frontier to the target can cover up to kMaxPathfindSteps
+    // pieces each of which needs costing. That is too slow to do within a single tick so the walk
+    // is done as a job that does at most kPathfindStepsPerTick pieces each time the company thinks.
+    constexpr uint16_t kMaxPathfindSteps = 400;
+    constexpr uint16_t kPathfindStepsPerTick = 40;
+
+    struct PathfindJob
+    {
+        // Inputs
+        World::Pos3 startPos;
+        uint16_t startTad;
+        World::Pos3 targetPos;
+        uint8_t targetRot;
+        uint8_t trackRoadObjId;
+        int32_t startWeighting;
+        // Progress
+        bool isRunning;
+        bool hasExistingConnection;
+        uint16_t step;
+        World::Pos3 pos;
+        uint16_t tad;
+        uint32_t unk112C360;
+        PathfindResult result;
+    };
+
+    static std::array<PathfindJob, Limits::kMaxCompanies> _pathfindJobs;
+
+    // 0x00485DBD
+    static void finishPathfindTargetReached(PathfindJob& job)
+    {
+        const auto isRoad = job.trackRoadObjId & (1U << 7);
+        const auto posA = job.startPos + (isRoad ? World::TrackData::getUnkRoad(job.startTad).pos : World::TrackData::getUnkTrack(job.startTad).pos);
+        const auto posB = job.targetPos + World::Pos3(World::kRotationOffset[job.targetRot], 0);
+        job.result.euclideanDistance = Math::Vector::distance3D(posA, posB);
+        job.result.state = job.hasExistingConnection ? PathfindResultState::targetReachedWithConnection : PathfindResultState::targetReached;
+        job.isRunning = false;
+    }
+
+    static void finishPathfindNoRoute(PathfindJob& job)
+    {
+        job.result.state = PathfindResultState::noRoute;
+        job.isRunning = false;
+    }
+
+    // 0x00485B75 (single piece)
     // startPos.x: 0x0112C3C6
     // startPos.y: 0x0112C3C8
     // startPos.z: 0x0112C517 * World::kSmallZStep
@@ -2142,94 +2265,91 @@ namespace OpenLoco::CompanyAi
     // targetPos.z: 0x0112C515 * World::kSmallZStep
     // targetRot: 0x0112C516
     // trackObjId: 0x0112C519
-    static PathfindResult sub_485B75(const World::Pos3 startPos, const uint16_t startTad, const World::Pos3 targetPos, const uint8_t targetRot, const uint8_t trackObjId, const CompanyId companyId)
+    static void stepTrackPathfind(PathfindJob& job, const uint8_t trackObjId, const CompanyId companyId)
     {
-        PathfindResult result{};
-        bool hasExistingTrackConnection = false;
-        uint32_t unk112C360 = _pathFindTotalTrackRoadWeighting;
-        World::Pos3 pos = startPos;
-        uint16_t tad = startTad;
-        for (auto i = 0U; i < 400; ++i)
+        if (job.step >= kMaxPathfindSteps)
         {
-            if (pos == targetPos)
-            {
-                // 0x00485DBD
-                const auto posA = startPos + World::TrackData::getUnkTrack(startTad).pos;
-                const auto posB = targetPos + World::Pos3(World::kRotationOffset[targetRot], 0);
-                result.euclideanDistance = Math::Vector::distance3D(posA, posB);
-                result.state = hasExistingTrackConnection ? PathfindResultState::targetReachedWithConnection : PathfindResultState::targetReached;
-                return result;
-            }
+            finishPathfindNoRoute(job);
+            return;
+        }
+        job.step++;
 
-            const uint8_t trackId = (tad >> 3U) & 0x3F;
-            const uint8_t rotation = tad & 0x3U;
-            const auto unkWeighting = World::TrackData::getTrackMiscData(trackId).unkWeighting;
-            result.totalWeighting += unkWeighting;
-            unk112C360 -= unkWeighting;
+        auto& result = job.result;
+        const auto pos = job.pos;
+        auto tad = job.tad;
+        if (pos == job.targetPos)
+        {
+            finishPathfindTargetReached(job);
+            return;
+        }
 
-            auto posAdjusted = pos;
-            posAdjusted.z += World::TrackData::getTrackPiece(trackId)[0].z;
+        const uint8_t trackId = (tad >> 3U) & 0x3F;
+        const uint8_t rotation = tad & 0x3U;
+        const auto unkWeighting = World::TrackData::getTrackMiscData(trackId).unkWeighting;
+        result.totalWeighting += unkWeighting;
+        job.unk112C360 -= unkWeighting;
 
-            {
-                GameCommands::AiTrackReplacementArgs args{};
-                args.pos = posAdjusted;
-                args.rotation = tad & 0x3U;
-                args.sequenceIndex = 0;
-                args.trackId = trackId;
-                args.trackObjectId = trackObjId;
+        auto posAdjusted = pos;
+        posAdjusted.z += World::TrackData::getTrackPiece(trackId)[0].z;
 
-                auto regs(static_cast<GameCommands::registers>(args));
-                regs.bl = 0;
-                GameCommands::aiTrackReplacement(regs);
-                if (static_cast<uint32_t>(regs.ebx) != GameCommands::FAILURE)
-                {
-                    result.totalCost += static_cast<uint32_t>(regs.ebx);
-                }
-            }
-            if (sub_4A80E1(posAdjusted, rotation, 0, trackId, trackObjId))
-            {
-                result.totalPenalties += unkWeighting;
-            }
-            if (result.totalWeighting > 128 && unk112C360 > 64)
-            {
-                if (connectsToExistingTrack(posAdjusted, rotation, 0, trackId, trackObjId))
-                {
-                    hasExistingTrackConnection = true;
-                }
-            }
-            const auto rotationBegin = World::TrackData::getUnkTrack(tad).rotationBegin;
-            auto nextPos = pos;
-            if (rotationBegin < 12)
-            {
-                nextPos -= World::Pos3(World::kRotationOffset[rotationBegin], 0);
-            }
-            const auto nextRot = World::kReverseRotation[rotationBegin];
-            const auto tc = World::Track::getTrackConnectionsAi(nextPos, nextRot, companyId, trackObjId, 0, 0);
-            if (tc.connections.empty() || tc.connections.size() > 1)
-            {
-                result.state = PathfindResultState::noRoute;
-                return result;
-            }
+        {
+            GameCommands::AiTrackReplacementArgs args{};
+            args.pos = posAdjusted;
+            args.rotation = tad & 0x3U;
+            args.sequenceIndex = 0;
+            args.trackId = trackId;
+            args.trackObjectId = trackObjId;
 
-            tad = tc.connections[0] & World::Track::AdditionalTaDFlags::basicTaDMask;
-            const auto& trackSize = World::TrackData::getUnkTrack(tad);
-            pos = nextPos + trackSize.pos;
-            if (trackSize.rotationEnd < 12)
+            auto regs(static_cast<GameCommands::registers>(args));
+            regs.bl = 0;
+            GameCommands::aiTrackReplacement(regs);
+            if (static_cast<uint32_t>(regs.ebx) != GameCommands::FAILURE)
             {
-                pos -= World::Pos3(World::kRotationOffset[trackSize.rotationEnd], 0);
+                result.totalCost += static_cast<uint32_t>(regs.ebx);
             }
-            tad ^= (1U << 2);
-            if (tad & (1U << 2))
+        }
+        if (sub_4A80E1(posAdjusted, rotation, 0, trackId, trackObjId))
+        {
+            result.totalPenalties += unkWeighting;
+        }
+        if (result.totalWeighting > 128 && job.unk112C360 > 64)
+        {
+            if (connectsToExistingTrack(posAdjusted, rotation, 0, trackId, trackObjId))
             {
-                // Odd? what is this doing
-                tad = (tad & 0x3) | (0U << 3);
+                job.hasExistingConnection = true;
             }
         }
-        result.state = PathfindResultState::noRoute;
-        return result;
+        const auto rotationBegin = World::TrackData::getUnkTrack(tad).rotationBegin;
+        auto nextPos = pos;
+        if (rotationBegin < 12)
+        {
+            nextPos -= World::Pos3(World::kRotationOffset[rotationBegin], 0);
+        }
+        const auto nextRot = World::kReverseRotation[rotationBegin];
+        const auto tc = World::Track::getTrackConnectionsAi(nextPos, nextRot, companyId, trackObjId, 0, 0);
+        if (tc.connections.empty() || tc.connections.size() > 1)
+        {
+            finishPathfindNoRoute(job);
+            return;
+        }
+
+        tad = tc.connections[0] & World::Track::AdditionalTaDFlags::basicTaDMask;
+        const auto& trackSize = World::TrackData::getUnkTrack(tad);
+        job.pos = nextPos + trackSize.pos;
+        if (trackSize.rotationEnd < 12)
+        {
+            job.pos -= World::Pos3(World::kRotationOffset[trackSize.rotationEnd], 0);
+        }
+        tad ^= (1U << 2);
+        if (tad & (1U << 2))
+        {
+            // Odd? what is this doing
+            tad = (tad & 0x3) | (0U << 3);
+        }
+        job.tad = tad;
     }
 
-    // 0x00485E6A
+    // 0x00485E6A (single piece)
     // startPos.x: 0x0112C3C6
     // startPos.y: 0x0112C3C8
     // startPos.z: 0x0112C517 * World::kSmallZStep
@@ -2239,115 +2359,277 @@ namespace OpenLoco::CompanyAi
     // targetPos.z: 0x0112C515 * World::kSmallZStep
     // targetRot: 0x0112C516
     // roadObjId: 0x0112C519
-    static PathfindResult sub_485E6A(const World::Pos3 startPos, const uint16_t startTad, const World::Pos3 targetPos, const uint8_t targetRot, const uint8_t roadObjId, const CompanyId companyId)
+    static void stepRoadPathfind(PathfindJob& job, const uint8_t roadObjId, const CompanyId companyId)
     {
-        PathfindResult result{};
-        bool hasExistingRoadConnection = false;
-        World::Pos3 pos = startPos;
-        uint16_t tad = startTad;
-        bool targetReached = false;
-        for (auto i = 0U; i < 400; ++i)
+        if (job.step >= kMaxPathfindSteps)
         {
-            if (pos == targetPos)
-            {
-                targetReached = true;
-                break;
-            }
+            finishPathfindNoRoute(job);
+            return;
+        }
+        job.step++;
 
-            const uint8_t roadId = (tad >> 3U) & 0xF;
-            const uint8_t rotation = tad & 0x3U;
-            const auto unkWeighting = World::TrackData::getRoadMiscData(roadId).unkWeighting;
-            result.totalWeighting += unkWeighting;
+        auto& result = job.result;
+        const auto pos = job.pos;
+        auto tad = job.tad;
+        if (pos == job.targetPos)
+        {
+            // 0x004860F4
+            finishPathfindTargetReached(job);
+            return;
+        }
 
-            auto posAdjusted = pos;
-            posAdjusted.z += World::TrackData::getRoadPiece(roadId)[0].z;
+        const uint8_t roadId = (tad >> 3U) & 0xF;
+        const uint8_t rotation = tad & 0x3U;
+        const auto unkWeighting = World::TrackData::getRoadMiscData(roadId).unkWeighting;
+        result.totalWeighting += unkWeighting;
 
-            result.totalCost += static_cast<uint32_t>(RoadReplacePrice::aiRoadReplacementCost(posAdjusted, rotation, 0, roadId, companyId));
+        auto posAdjusted = pos;
+        posAdjusted.z += World::TrackData::getRoadPiece(roadId)[0].z;
 
-            if (sub_47B336(posAdjusted, rotation, 0, roadId, companyId))
-            {
-                result.totalPenalties += unkWeighting;
-            }
+        result.totalCost += static_cast<uint32_t>(RoadReplacePrice::aiRoadReplacementCost(posAdjusted, rotation, 0, roadId, companyId));
 
-            if (willRoadDestroyABuilding(posAdjusted, rotation, 0, roadId, companyId))
-            {
-                result.totalPenalties += unkWeighting;
-            }
+        if (sub_47B336(posAdjusted, rotation, 0, roadId, companyId))
+        {
+            result.totalPenalties += unkWeighting;
+        }
 
-            if (connectsToExistingRoad(posAdjusted, rotation, 0, roadId, companyId))
-            {
-                hasExistingRoadConnection = true;
-            }
+        if (willRoadDestroyABuilding(posAdjusted, rotation, 0, roadId, companyId))
+        {
+            result.totalPenalties += unkWeighting;
+        }
 
-            const auto rotationBegin = World::TrackData::getUnkRoad(tad).rotationBegin;
-            const auto nextPos = pos - World::Pos3(World::kRotationOffset[rotationBegin], 0);
-            const auto nextRot = World::kReverseRotation[rotationBegin];
-            uint8_t matchRoadObjId = roadObjId;
-            auto* roadObj = ObjectManager::get<RoadObject>(roadObjId);
-            if (roadObj->hasFlags(RoadObjectFlags::anyRoadTypeCompatible))
-            {
-                matchRoadObjId = 0xFFU; // any road object
-            }
+        if (connectsToExistingRoad(posAdjusted, rotation, 0, roadId, companyId))
+        {
+            job.hasExistingConnection = true;
+        }
+
+        const auto rotationBegin = World::TrackData::getUnkRoad(tad).rotationBegin;
+        const auto nextPos = pos - World::Pos3(World::kRotationOffset[rotationBegin], 0);
+        const auto nextRot = World::kReverseRotation[rotationBegin];
+        uint8_t matchRoadObjId = roadObjId;
+        auto* roadObj = ObjectManager::get<RoadObject>(roadObjId);
+        if (roadObj->hasFlags(RoadObjectFlags::anyRoadTypeCompatible))
+        {
+            matchRoadObjId = 0xFFU; // any road object
+        }
 
-            const auto rc = World::Track::getRoadConnectionsAiAllocated(nextPos, nextRot, companyId, matchRoadObjId, 0, 0);
-            if (rc.connections.size() > 1)
+        const auto rc = World::Track::getRoadConnectionsAiAllocated(nextPos, nextRot, companyId, matchRoadObjId, 0, 0);
+        if (rc.connections.size() > 1)
+        {
+            finishPathfindNoRoute(job);
+            return;
+        }
+        if (rc.connections.empty())
+        {
+            if (nextPos == job.targetPos)
             {
-                result.state = PathfindResultState::noRoute;
-                return result;
+                finishPathfindTargetReached(job);
             }
-            if (rc.connections.empty())
+            else
             {
-                if (nextPos == targetPos)
-                {
-                    targetReached = true;
-                }
-                break;
+                finishPathfindNoRoute(job);
             }
+            return;
+        }
 
-            tad = rc.connections[0] & World::Track::AdditionalTaDFlags::basicTaDMask;
-            const auto& roadSize = World::TrackData::getUnkRoad(tad);
-            pos = nextPos + roadSize.pos - World::Pos3(World::kRotationOffset[roadSize.rotationEnd], 0);
+        tad = rc.connections[0] & World::Track::AdditionalTaDFlags::basicTaDMask;
+        const auto& roadSize = World::TrackData::getUnkRoad(tad);
+        job.pos = nextPos + roadSize.pos - World::Pos3(World::kRotationOffset[roadSize.rotationEnd], 0);
 
-            tad ^= (1U << 2);
-            if (tad & (1U << 2))
-            {
-                // Odd? what is this doing
-                tad = (tad & 0x3) | (0U << 3);
-            }
-        }
-        if (targetReached)
-        {
-            // 0x004860F4
-            const auto posA = startPos + World::TrackData::getUnkRoad(startTad).pos;
-            const auto posB = targetPos + World::Pos3(World::kRotationOffset[targetRot], 0);
-            result.euclideanDistance = Math::Vector::distance3D(posA, posB);
-            result.state = hasExistingRoadConnection ? PathfindResultState::targetReachedWithConnection : PathfindResultState::targetReached;
-            return result;
-        }
-        else
+        tad ^= (1U << 2);
+        if (tad & (1U << 2))
         {
-            result.state = PathfindResultState::noRoute;
-            return result;
+            // Odd? what is this doing
+            tad = (tad & 0x3) | (0U << 3);
         }
+        job.tad = tad;
     }
 
     // 0x00485B68
-    static PathfindResult sub_485B68(const uint8_t trackRoadObjId)
+    // Returns std::nullopt if the route has not been fully walked yet. Calling again with the
+    // same pathfind state continues the walk from where it left off.
+    static std::optional<PathfindResult> sub_485B68(Company& company, const uint8_t trackRoadObjId)
     {
         const auto startPos = World::Pos3{ _unk2Pos112C3C6.x, _unk2Pos112C3C6.y, _unk2PosBaseZ112C517 * World::kSmallZStep };
         const auto startTad = _unkTad112C3CA;
         const auto targetPos = World::Pos3{ _unk1Pos112C3C2.x, _unk1Pos112C3C2.y, _unk1PosBaseZ112C515 * World::kSmallZStep };
         const auto targetRot = _unk1Rot112C516;
         const auto companyId = GameCommands::getUpdatingCompanyId();
-        if (trackRoadObjId & (1U << 7))
+
+        auto& job = _pathfindJobs[enumValue(company.id())];
+        if (!job.isRunning || job.startPos != startPos || job.startTad != startTad || job.targetPos != targetPos || job.targetRot != targetRot || job.trackRoadObjId != trackRoadObjId || job.startWeighting != _pathFindTotalTrackRoadWeighting)
         {
-            const auto roadObjId = trackRoadObjId & ~(1U << 7);
-            return sub_485E6A(startPos, startTad, targetPos, targetRot, roadObjId, companyId);
+            job = PathfindJob{};
+            job.startPos = startPos;
+            job.startTad = startTad;
+            job.targetPos = targetPos;
+            job.targetRot = targetRot;
+            job.trackRoadObjId = trackRoadObjId;
+            job.startWeighting = _pathFindTotalTrackRoadWeighting;
+            job.isRunning = true;
+            job.pos = startPos;
+            job.tad = startTad;
+            job.unk112C360 = _pathFindTotalTrackRoadWeighting;
         }
-        else
+
+        for (auto i = 0U; i < kPathfindStepsPerTick && job.isRunning; ++i)
+        {
+            if (trackRoadObjId & (1U << 7))
+            {
+                const auto roadObjId = trackRoadObjId & ~(1U << 7);
+                stepRoadPathfind(job, roadObjId, companyId);
+            }
+            else
+            {
+                const auto trackObjId = trackRoadObjId;
+                stepTrackPathfind(job, trackObjId, companyId);
+            }
+        }
+
+        if (job.isRunning)
+        {
+            return std::nullopt;
+        }
+        return job.result;
+    }
+
+    // Job layout, every field in declaration order without padding:
+    //   Pos3 startPos, uint16_t startTad, Pos3 targetPos, uint8_t targetRot, uint8_t trackRoadObjId,
+    //   int32_t startWeighting, uint8_t hasExistingConnection, uint16_t step, Pos3 pos, uint16_t tad,
+    //   uint32_t unk112C360, uint8_t resultState, int32_t totalCost, uint32_t totalPenalties,
+    //   uint32_t euclideanDistance, uint32_t totalWeighting
+    static void writePos3(MemoryStream& ms, const World::Pos3& pos)
+    {
+        ms.writeValue<int16_t>(pos.x);
+        ms.writeValue<int16_t>(pos.y);
+        ms.writeValue<int16_t>(pos.z);
+    }
+
+    static World::Pos3 readPos3(MemoryStream& ms)
+    {
+        const auto x = ms.readValue<int16_t>();
+        const auto y = ms.readValue<int16_t>();
+        const auto z = ms.readValue<int16_t>();
+        return World::Pos3(x, y, z);
+    }
+
+    static void writePathfindJob(MemoryStream& ms, const PathfindJob& job)
+    {
+        writePos3(ms, job.startPos);
+        ms.writeValue<uint16_t>(job.startTad);
+        writePos3(ms, job.targetPos);
+        ms.writeValue<uint8_t>(job.targetRot);
+        ms.writeValue<uint8_t>(job.trackRoadObjId);
+        ms.writeValue<int32_t>(job.startWeighting);
+        ms.writeValue<uint8_t>(job.hasExistingConnection ? 1 : 0);
+        ms.writeValue<uint16_t>(job.step);
+        writePos3(ms, job.pos);
+        ms.writeValue<uint16_t>(job.tad);
+        ms.writeValue<uint32_t>(job.unk112C360);
+        ms.writeValue<uint8_t>(enumValue(job.result.state));
+        ms.writeValue<int32_t>(job.result.totalCost);
+        ms.writeValue<uint32_t>(job.result.totalPenalties);
+        ms.writeValue<uint32_t>(job.result.euclideanDistance);
+        ms.writeValue<uint32_t>(job.result.totalWeighting);
+    }
+
+    static PathfindJob readPathfindJob(MemoryStream& ms)
+    {
+        PathfindJob job{};
+        job.startPos = readPos3(ms);
+        job.startTad = ms.readValue<uint16_t>();
+        job.targetPos = readPos3(ms);
+        job.targetRot = ms.readValue<uint8_t>();
+        job.trackRoadObjId = ms.readValue<uint8_t>();
+        job.startWeighting = ms.readValue<int32_t>();
+        job.hasExistingConnection = ms.readValue<uint8_t>() != 0;
+        job.step = ms.readValue<uint16_t>();
+        job.pos = readPos3(ms);
+        job.tad = ms.readValue<uint16_t>();
+        job.unk112C360 = ms.readValue<uint32_t>();
+        job.result.state = static_cast<PathfindResultState>(ms.readValue<uint8_t>());
+        job.result.totalCost = ms.readValue<int32_t>();
+        job.result.totalPenalties = ms.readValue<uint32_t>();
+        job.result.euclideanDistance = ms.readValue<uint32_t>();
+        job.result.totalWeighting = ms.readValue<uint32_t>();
+        job.isRunning = true;
+        return job;
+    }
+
+    // Chunk layout:
+    //   uint32_t magic, uint8_t numJobs
+    //   numJobs * { CompanyId id, job }
+    std::vector<std::byte> exportPathfindJobs()
+    {
+        const auto numJobs = std::count_if(std::begin(_pathfindJobs), std::end(_pathfindJobs), [](const auto& job) { return job.isRunning; });
+        if (numJobs == 0)
         {
-            const auto trackObjId = trackRoadObjId;
-            return sub_485B75(startPos, startTad, targetPos, targetRot, trackObjId, companyId);
+            return {};
+        }
+
+        MemoryStream ms;
+        ms.writeValue(kPathfindJobsMagic);
+        ms.writeValue(static_cast<uint8_t>(numJobs));
+        for (auto i = 0U; i < _pathfindJobs.size(); ++i)
+        {
+            if (!_pathfindJobs[i].isRunning)
+            {
+                continue;
+            }
+            ms.writeValue(CompanyId(i));
+            writePathfindJob(ms, _pathfindJobs[i]);
+        }
+
+        const auto span = ms.getSpan();
+        return std::vector<std::byte>(span.begin(), span.end());
+    }
+
+    void resetPathfindJob(const CompanyId id)
+    {
+        _pathfindJobs[enumValue(id)] = PathfindJob{};
+    }
+
+    void resetPathfindJobs()
+    {
+        for (auto& job : _pathfindJobs)
+        {
+            job = PathfindJob{};
+        }
+    }
+
+    void importPathfindJobs(std::span<const std::byte> data)
+    {
+        resetPathfindJobs();
+        if (data.empty())
+        {
+            return;
+        }
+
+        MemoryStream ms;
+        ms.write(data.data(), data.size());
+        ms.setPosition(0);
+        try
+        {
+            if (ms.readValue<uint32_t>() != kPathfindJobsMagic)
+            {
+                Logging::warn("Ignoring unknown ai pathfind chunk");
+                return;
+            }
+            const auto numJobs = ms.readValue<uint8_t>();
+            for (auto i = 0U; i < numJobs; ++i)
+            {
+                const auto id = ms.readValue<CompanyId>();
+                const auto job = readPathfindJob(ms);
+                if (enumValue(id) >= _pathfindJobs.size())
+                {
+                    throw Exception::RuntimeError("Invalid company id");
+                }
+                _pathfindJobs[enumValue(id)] = job;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to read ai pathfind jobs: {}", e.what());
         }
     }
 
@@ -2369,7 +2651,13 @@ namespace OpenLoco::CompanyAi
     // 0x00484508
     static bool evaluatePathfound(Company& company, AiThought& thought, const uint8_t trackRoadObjId)
     {
-        const auto pathResult = sub_485B68(trackRoadObjId);
+        const auto walkResult = sub_485B68(company, trackRoadObjId);
+        if (!walkResult.has_value())
+        {
+            // Continue walking the route next time
+            return false;
+        }
+        const auto& pathResult = *walkResult;
         const auto pathfindState = pathResult.state;
         if (pathfindState == PathfindResultState::noRoute)
         {
@@ -2490,8 +2778,13 @@ namespace OpenLoco::CompanyAi
                     {
                         // 0x004845EF
 
-                        const auto pathfindState = sub_485B68(placementVars.trackRoadObjId).state;
-                        if (pathfindState == PathfindResultState::noRoute)
+                        const auto walkResult = sub_485B68(company, placementVars.trackRoadObjId);
+                        if (!walkResult.has_value())
+                        {
+                            // Continue walking the route next time
+                            return false;
+                        }
+                        if (walkResult->state == PathfindResultState::noRoute)
                         {
                             return true;
                         }
@@ -2588,8 +2881,13 @@ namespace OpenLoco::CompanyAi
                     {
                         // 0x004845EF duplicate
 
-                        const auto pathfindState = sub_485B68(placementVars.trackRoadObjId).state;
-                        if (pathfindState == PathfindResultState::noRoute)
+                        const auto walkResult = sub_485B68(company, placementVars.trackRoadObjId);
+                        if (!walkResult.has_value())
+                        {
+                            // Continue walking the route next time
+                            return false;
+                        }
+                        if (walkResult->state == PathfindResultState::noRoute)
                         {
                             return true;
                         }
@@ -1,5 +1,11 @@
 #pragma once
 
+#include "Types.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
 namespace OpenLoco
 {
     struct Company;
@@ -9,4 +15,12 @@ namespace OpenLoco
 namespace OpenLoco::CompanyAi
 {
     bool aiPathfind(Company& company, AiThought& thought);
+
+    // Route walks that are spread over several ticks are saved as an extension chunk
+    constexpr uint32_t kPathfindJobsMagic = 0x46504941; // "AIPF"
+    std::vector<std::byte> exportPathfindJobs();
+    void importPathfindJobs(std::span<const std::byte> data);
+    // A company that is reset or removed must not continue the walk of its previous owner
+    void resetPathfindJob(CompanyId id);
+    void resetPathfindJobs();
 }
@@ -1,5 +1,6 @@
 #include "CompanyManager.h"
 #include "CompanyAi/CompanyAi.h"
+#include "CompanyAi/CompanyAiPathfinding.h"
 #include "CompanyRecords.h"
 #include "Config.h"
 #include "Date.h"
@@ -41,6 +42,7 @@
 #include "Vehicles/VehicleManager.h"
 #include <OpenLoco/Math/Bound.hpp>
 #include <array>
+#include <chrono>
 #include <sfl/static_vector.hpp>
 
 using namespace OpenLoco::Ui;
@@ -71,6 +73,7 @@ namespace OpenLoco::CompanyManager
         }
 
         getGameState().produceAICompanyTimeout = 0;
+        CompanyAi::resetPathfindJobs();
 
         // Reset player companies depending on network mode.
         if (SceneManager::isNetworkHost())
@@ -233,7 +236,22 @@ namespace OpenLoco::CompanyManager
                 if (!SceneManager::isNetworked() || SceneManager::isNetworkHost())
                 {
                     GameCommands::setUpdatingCompanyId(id);
-                    aiThink(id);
+
+                    if (!isAiThinkStatsEnabled())
+                    {
+                        aiThink(id);
+                    }
+                    else
+                    {
+                        const auto startTime = std::chrono::high_resolution_clock::now();
+                        const auto startCommands = GameCommands::getNumCommandsIssued();
+                        aiThink(id);
+
+                        auto& stats = getAiThinkStats(id);
+                        stats.numThinks++;
+                        stats.duration += std::chrono::high_resolution_clock::now() - startTime;
+                        stats.numGameCommands += GameCommands::getNumCommandsIssued() - startCommands;
+                    }
                 }
             }
 
@@ -260,9 +278,10 @@ namespace OpenLoco::CompanyManager
     {
         setCompetitorStartDelay(Math::Bound::sub(getCompetitorStartDelay(), 1U));
 
+        const auto vehicleTotals = calculateCompanyVehicleTotals();
         for (auto& company : companies())
         {
-            company.updateMonthly1();
+            company.updateMonthly1(vehicleTotals[enumValue(company.id())]);
         }
         Ui::WindowManager::invalidate(Ui::WindowType::company);
         Ui::WindowManager::invalidate(Ui::WindowType::companyList);
@@ -560,6 +579,7 @@ namespace OpenLoco::CompanyManager
             return CompanyId::null;
         }
 
+        CompanyAi::resetPathfindJob(chosenCompanyId);
         auto* company = get(chosenCompanyId);
         company->competitorId = competitorId;
         auto* competitorObj = ObjectManager::get<CompetitorObject>(competitorId);
@@ -1405,6 +1425,7 @@ namespace OpenLoco::CompanyManager
         Ui::Windows::CompanyList::removeCompany(id);
         MessageManager::removeAllSubjectRefs(enumValue(id), MessageItemArgumentType::company);
         removeCompaniesRecords(id);
+        CompanyAi::resetPathfindJob(id);
         StringManager::emptyUserString(company->name);
         company->name = StringIds::empty;
         StringManager::emptyUserString(company->ownerName);
@@ -27,6 +27,10 @@ using namespace OpenLoco::World;
 
 namespace OpenLoco
 {
+    // The set bits of each industry's stationsInRange so that they can be visited without
+    // scanning every possible station
+    static std::array<std::vector<StationId>, Limits::kMaxIndustries> _stationsInRangeLists;
+
     const std::array<Unk4F9274, 1> word_4F9274 = {
         Unk4F9274{ { 0, 0 }, 0 },
     };
@@ -687,6 +691,10 @@ namespace OpenLoco
     {
         const auto* industryObj = getObject();
 
+        // The ratings are insertion sorted so ties depend on visiting the stations in id order
+        auto& stationsInRangeList = _stationsInRangeLists[enumValue(id())];
+        std::sort(stationsInRangeList.begin(), stationsInRangeList.end());
+
         for (auto cargoNum = 0; cargoNum < 2; ++cargoNum)
         {
             auto& indStatsStation = producedCargoStatsStation[cargoNum];
@@ -698,15 +706,8 @@ namespace OpenLoco
                 continue;
             }
 
-            auto id = 0;
-            for (const auto& hasBit : stationsInRange)
+            for (const auto stationId : stationsInRangeList)
             {
-                const auto stationId = static_cast<StationId>(id);
-                id++;
-                if (!hasBit)
-                {
-                    continue;
-                }
                 const auto* station = StationManager::get(stationId);
                 if (station->empty())
                 {
@@ -742,6 +743,43 @@ namespace OpenLoco
                 ratingFraction = -rating;
             }
         }
+        resetStationsInRange();
+    }
+
+    void Industry::addStationInRange(const StationId stationId)
+    {
+        if (stationsInRange.get(enumValue(stationId)))
+        {
+            return;
+        }
+        stationsInRange.set(enumValue(stationId), true);
+        _stationsInRangeLists[enumValue(id())].push_back(stationId);
+    }
+
+    void Industry::resetStationsInRange()
+    {
         stationsInRange.reset();
+        _stationsInRangeLists[enumValue(id())].clear();
+    }
+
+    void syncIndustryStationsInRange()
+    {
+        for (auto i = 0U; i < Limits::kMaxIndustries; ++i)
+        {
+            auto& list = _stationsInRangeLists[i];
+            list.clear();
+            auto* industry = IndustryManager::get(static_cast<IndustryId>(i));
+            if (industry == nullptr || industry->empty())
+            {
+                continue;
+            }
+            for (auto stationIndex = 0U; stationIndex < Limits::kMaxStations; ++stationIndex)
+            {
+                if (industry->stationsInRange.get(stationIndex))
+                {
+                    list.push_back(static_cast<StationId>(stationIndex));
+                }
+            }
+        }
     }
 }
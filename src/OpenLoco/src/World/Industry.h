@@ -87,6 +87,8 @@ namespace OpenLoco
         void expandGrounds(const World::Pos2& pos, uint8_t primaryWallType, uint8_t wallEntranceType, uint8_t growthStage, uint8_t updateTimer);
         void createMapAnimations();
         void updateProducedCargoStats();
+        void addStationInRange(StationId stationId);
+        void resetStationsInRange();
 
         constexpr bool hasFlags(IndustryFlags flagsToTest) const
         {
@@ -95,4 +97,6 @@ namespace OpenLoco
     };
 
     bool claimSurfaceForIndustry(const World::TilePos2& pos, IndustryId industryId, uint8_t growthStage, uint8_t updateTimer);
+    // Rebuilds the lists of stations in range from the stationsInRange bitsets (e.g. after loading)
+    void syncIndustryStationsInRange();
 }
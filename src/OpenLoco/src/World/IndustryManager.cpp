@@ -65,6 +65,7 @@ namespace OpenLoco::IndustryManager
         {
             industry.name = StringIds::null;
         }
+        syncIndustryStationsInRange();
         Ui::Windows::IndustryList::reset();
     }
 
@@ -594,7 +595,7 @@ namespace OpenLoco::IndustryManager
             industry->numIdleFarmTiles = 0;
             industry->productionRate = 25;
             industry->foundingYear = getCurrentYear();
-            industry->stationsInRange = {};
+            industry->resetStationsInRange();
             for (auto& stats : industry->producedCargoStatsStation)
             {
                 std::fill(std::begin(stats), std::end(stats), StationId::null);
@@ -1,4 +1,5 @@
 #include "Station.h"
+#include "AirportMovementGraph.h"
 #include "CompanyManager.h"
 #include "Graphics/Gfx.h"
 #include "Graphics/ImageIds.h"
@@ -33,6 +34,7 @@
 #include "TownManager.h"
 #include "Ui/WindowManager.h"
 #include "ViewportManager.h"
+#include <OpenLoco/Diagnostics/Logging.h>
 #include <OpenLoco/Math/Bound.hpp>
 #include <algorithm>
 #include <cassert>
@@ -207,9 +209,76 @@ namespace OpenLoco
         updateCargoAcceptance();
     }
 
+    // Cargo acceptance only depends on what is inside the catchment so it is only recalculated
+    // once something there (or the station itself) has changed since the last calculation.
+    struct CargoAcceptanceCache
+    {
+        bool isValid;
+        TilePos2 catchmentMin;
+        TilePos2 catchmentMax;
+    };
+
+    static std::array<CargoAcceptanceCache, Limits::kMaxStations> _cargoAcceptanceCache;
+
+    static std::pair<TilePos2, TilePos2> getCatchmentBounds(const Station& station);
+
+    void invalidateCargoAcceptance(const TilePos2& minPos, const TilePos2& maxPos)
+    {
+        for (auto& cache : _cargoAcceptanceCache)
+        {
+            if (!cache.isValid)
+            {
+                continue;
+            }
+            if (maxPos.x < cache.catchmentMin.x || minPos.x > cache.catchmentMax.x || maxPos.y < cache.catchmentMin.y || minPos.y > cache.catchmentMax.y)
+            {
+                continue;
+            }
+            cache.isValid = false;
+        }
+    }
+
+    void invalidateCargoAcceptance(const TilePos2& pos)
+    {
+        invalidateCargoAcceptance(pos, pos);
+    }
+
+    void invalidateAllCargoAcceptance()
+    {
+        _cargoAcceptanceCache.fill({});
+    }
+
+#ifndef NDEBUG
+    // Cross checks a cached acceptance against a full recalculation
+    static void verifyCargoAcceptance(const Station& station)
+    {
+        CargoSearchState cargoSearchState;
+        const uint32_t acceptedCargo = station.calcAcceptedCargo(cargoSearchState);
+        for (uint32_t cargoId = 0; cargoId < kMaxCargoStats; cargoId++)
+        {
+            const auto& stationCargoStats = station.cargoStats[cargoId];
+            const bool isAccepted = (acceptedCargo & (1 << cargoId)) != 0;
+            if (stationCargoStats.isAccepted() != isAccepted || stationCargoStats.industryId != cargoSearchState.getIndustry(cargoId))
+            {
+                Diagnostics::Logging::error("Station {} has stale cargo acceptance for cargo {}", enumValue(station.id()), cargoId);
+                return;
+            }
+        }
+    }
+#endif
+
     // 0x00492640
     void Station::updateCargoAcceptance()
     {
+        auto& cache = _cargoAcceptanceCache[enumValue(id())];
+        if (cache.isValid)
+        {
+#ifndef NDEBUG
+            verifyCargoAcceptance(*this);
+#endif
+            return;
+        }
+
         CargoSearchState cargoSearchState;
         uint32_t currentAcceptedCargo = calcAcceptedCargo(cargoSearchState);
         uint32_t originallyAcceptedCargo = 0;
@@ -234,6 +303,8 @@ namespace OpenLoco
             }
             invalidateWindow();
         }
+        const auto [catchmentMin, catchmentMax] = getCatchmentBounds(*this);
+        cache = { true, catchmentMin, catchmentMax };
     }
 
     // 0x00492683
@@ -539,25 +610,32 @@ namespace OpenLoco
 
     static void setStationCatchmentRegion(TilePos2 minPos, TilePos2 maxPos, const CatchmentFlags flags);
 
-    // 0x00491D70
-    // catchment flag should not be shifted (1, 2, 3, 4) and NOT (1 << 0, 1 << 1)
-    void setCatchmentDisplay(const Station* station, const CatchmentFlags catchmentFlag)
+    // Tiles covered by the station element at pos
+    static std::pair<TilePos2, TilePos2> getStationElementFootprint(const Pos3& pos, const StationElement& stationElement)
     {
-        _cargoMap.resetTileRegion(0, 0, kMapColumns, kMapRows, catchmentFlag);
-
-        if (station == nullptr)
-        {
-            return;
-        }
-
-        if (station->stationTileSize == 0)
+        const auto tilePos = World::toTileSpace(pos);
+        switch (stationElement.stationType())
         {
-            return;
+            case StationType::airport:
+            {
+                auto airportObject = ObjectManager::get<AirportObject>(stationElement.objectId());
+                return airportObject->getAirportExtents(tilePos, stationElement.rotation());
+            }
+            case StationType::docks:
+                // Docks are always size 2x2
+                return std::make_pair(tilePos, tilePos + TilePos2(1, 1));
+            default:
+                return std::make_pair(tilePos, tilePos);
         }
+    }
 
-        for (uint16_t i = 0; i < station->stationTileSize; i++)
+    // Calls func with the unclamped catchment rectangle around each of the station's tiles
+    template<typename TFunc>
+    static void forEachCatchmentRegion(const Station& station, TFunc&& func)
+    {
+        for (uint16_t i = 0; i < station.stationTileSize; i++)
         {
-            auto pos = station->stationTiles[i];
+            auto pos = station.stationTiles[i];
             pos.z = World::heightFloor(pos.z);
 
             auto stationElement = getStationElement(pos);
@@ -567,50 +645,48 @@ namespace OpenLoco
                 continue;
             }
 
-            switch (stationElement->stationType())
-            {
-                case StationType::airport:
-                {
-                    auto airportObject = ObjectManager::get<AirportObject>(stationElement->objectId());
+            auto [minPos, maxPos] = getStationElementFootprint(pos, *stationElement);
 
-                    auto [minPos, maxPos] = airportObject->getAirportExtents(World::toTileSpace(pos), stationElement->rotation());
+            minPos.x -= catchmentSize;
+            minPos.y -= catchmentSize;
+            maxPos.x += catchmentSize;
+            maxPos.y += catchmentSize;
 
-                    minPos.x -= catchmentSize;
-                    minPos.y -= catchmentSize;
-                    maxPos.x += catchmentSize;
-                    maxPos.y += catchmentSize;
-
-                    setStationCatchmentRegion(minPos, maxPos, catchmentFlag);
-                }
-                break;
-                case StationType::docks:
-                {
-                    auto minPos = World::toTileSpace(pos);
-                    auto maxPos = minPos;
+            func(minPos, maxPos);
+        }
+    }
 
-                    minPos.x -= catchmentSize;
-                    minPos.y -= catchmentSize;
-                    // Docks are always size 2x2
-                    maxPos.x += catchmentSize + 1;
-                    maxPos.y += catchmentSize + 1;
+    static std::pair<TilePos2, TilePos2> getCatchmentBounds(const Station& station)
+    {
+        // An empty rectangle when the station has no tiles
+        TilePos2 boundsMin{ kMapColumns, kMapRows };
+        TilePos2 boundsMax{ -1, -1 };
+        forEachCatchmentRegion(station, [&boundsMin, &boundsMax](const TilePos2& minPos, const TilePos2& maxPos) {
+            boundsMin = TilePos2(std::min(boundsMin.x, minPos.x), std::min(boundsMin.y, minPos.y));
+            boundsMax = TilePos2(std::max(boundsMax.x, maxPos.x), std::max(boundsMax.y, maxPos.y));
+        });
+        return std::make_pair(boundsMin, boundsMax);
+    }
 
-                    setStationCatchmentRegion(minPos, maxPos, catchmentFlag);
-                }
-                break;
-                default:
-                {
-                    auto minPos = World::toTileSpace(pos);
-                    auto maxPos = minPos;
+    // 0x00491D70
+    // catchment flag should not be shifted (1, 2, 3, 4) and NOT (1 << 0, 1 << 1)
+    void setCatchmentDisplay(const Station* station, const CatchmentFlags catchmentFlag)
+    {
+        _cargoMap.resetTileRegion(0, 0, kMapColumns, kMapRows, catchmentFlag);
 
-                    minPos.x -= catchmentSize;
-                    minPos.y -= catchmentSize;
-                    maxPos.x += catchmentSize;
-                    maxPos.y += catchmentSize;
+        if (station == nullptr)
+        {
+            return;
+        }
 
-                    setStationCatchmentRegion(minPos, maxPos, catchmentFlag);
-                }
-            }
+        if (station->stationTileSize == 0)
+        {
+            return;
         }
+
+        forEachCatchmentRegion(*station, [catchmentFlag](const TilePos2& minPos, const TilePos2& maxPos) {
+            setStationCatchmentRegion(minPos, maxPos, catchmentFlag);
+        });
     }
 
     bool isWithinCatchmentDisplay(const World::Pos2 pos)
@@ -628,12 +704,18 @@ namespace OpenLoco
 
     // 0x0042F489
     void Station::deliverCargoToStation(const uint8_t cargoType, const uint8_t cargoQuantity)
+    {
+        addProducedCargo(cargoType, cargoQuantity);
+        updateCargoDistribution();
+    }
+
+    // As deliverCargoToStation but without updating the cargo distribution
+    void Station::addProducedCargo(const uint8_t cargoType, const uint32_t cargoQuantity)
     {
         auto& stationCargoStat = cargoStats[cargoType];
         stationCargoStat.quantity = Math::Bound::add(stationCargoStat.quantity, cargoQuantity);
         stationCargoStat.enrouteAge = 0;
         stationCargoStat.origin = id();
-        updateCargoDistribution();
     }
 
     // 0x00492A98
@@ -990,6 +1072,7 @@ namespace OpenLoco
             labelFrame.top[zoom] = uiTop;
             labelFrame.bottom[zoom] = uiBottom;
         }
+        Ui::ViewportManager::invalidateLabelIndex();
     }
 
     // 0x004CBA2D
@@ -1209,6 +1292,14 @@ namespace OpenLoco
         station->stationTiles[station->stationTileSize].z &= ~0x3;
         station->stationTiles[station->stationTileSize].z |= (rotation & 0x3);
         station->stationTileSize++;
+        // AI allocated stations only start covering producers once the AI confirms them
+        auto* stationElement = getStationElement(Pos3(pos.x, pos.y, World::heightFloor(pos.z)));
+        if (stationElement != nullptr && !stationElement->isAiAllocated())
+        {
+            const auto [minPos, maxPos] = getStationElementFootprint(pos, *stationElement);
+            StationManager::addCatchmentCoverage(stationId, minPos, maxPos);
+        }
+        _cargoAcceptanceCache[enumValue(stationId)].isValid = false;
 
         CargoSearchState cargoSearchState;
         const auto acceptedCargos = station->calcAcceptedCargo(cargoSearchState);
@@ -1253,6 +1344,9 @@ namespace OpenLoco
         auto* station = StationManager::get(stationId);
         auto findPos = pos;
         findPos.z |= rotation;
+        // The element has already been removed, airports and docks invalidate the rest of their footprint themselves
+        StationManager::invalidateCatchmentCoverage(World::toTileSpace(pos), World::toTileSpace(pos));
+        _cargoAcceptanceCache[enumValue(stationId)].isValid = false;
 
         // Find tile to remove
         auto foundTilePos = std::find(std::begin(station->stationTiles), std::end(station->stationTiles), findPos);
@@ -1348,45 +1442,12 @@ namespace OpenLoco
     // used to return NodeMovementFlags on ebx
     std::optional<World::Pos3> getAirportMovementNodeLoc(const StationId stationId, uint8_t node)
     {
-        auto* station = StationManager::get(stationId);
-        auto tile = World::TileManager::get(station->airportStartPos);
-        World::StationElement* elStation = nullptr;
-        for (auto& el : tile)
-        {
-            elStation = el.as<World::StationElement>();
-            if (elStation == nullptr)
-            {
-                continue;
-            }
-
-            if (elStation->baseZ() != station->airportStartPos.z / 4)
-            {
-                elStation = nullptr;
-                continue;
-            }
-            break;
-        }
-
-        if (elStation == nullptr)
+        const auto* graph = AirportMovementGraph::get(stationId);
+        if (graph == nullptr)
         {
             return {};
         }
-
-        auto* airportObj = ObjectManager::get<AirportObject>(elStation->objectId());
-        const auto movementNodes = airportObj->getMovementNodes();
-
-        const auto& movementNode = movementNodes[node];
-        auto nodeOffset = Math::Vector::rotate(World::Pos2(movementNode.x, movementNode.y) - World::Pos2(16, 16), elStation->rotation()) + World::Pos2(16, 16);
-        auto nodeLoc = World::Pos3{ nodeOffset.x, nodeOffset.y, movementNode.z } + station->airportStartPos;
-        if (!movementNode.hasFlags(AirportMovementNodeFlags::taxiing))
-        {
-            nodeLoc.z = station->airportStartPos.z + 255;
-            if (!movementNode.hasFlags(AirportMovementNodeFlags::inFlight))
-            {
-                nodeLoc.z = 30 * 32;
-            }
-        }
-        return { nodeLoc };
+        return { graph->nodeLocs[node] };
     }
 
     // 0x0048DBC2
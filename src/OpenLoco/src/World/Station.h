@@ -155,6 +155,7 @@ namespace OpenLoco
         void invalidateWindow();
 
         void deliverCargoToStation(const uint8_t cargoType, const uint8_t cargoQuantity);
+        void addProducedCargo(const uint8_t cargoType, const uint32_t cargoQuantity);
         void deliverCargoToTown(uint8_t cargoType, uint16_t cargoQuantity);
         void updateCargoDistribution();
 
@@ -165,6 +166,10 @@ namespace OpenLoco
 
     void setCatchmentDisplay(const Station* station, const CatchmentFlags flags);
     bool isWithinCatchmentDisplay(const World::Pos2 pos);
+    // Marks the cargo acceptance of any station whose catchment overlaps the area as needing recalculation
+    void invalidateCargoAcceptance(const World::TilePos2& minPos, const World::TilePos2& maxPos);
+    void invalidateCargoAcceptance(const World::TilePos2& pos);
+    void invalidateAllCargoAcceptance();
     struct PotentialCargo
     {
         uint32_t accepted;
@@ -1,4 +1,5 @@
 #include "StationManager.h"
+#include "AirportMovementGraph.h"
 #include "CompanyManager.h"
 #include "Config.h"
 #include "Game.h"
@@ -22,8 +23,10 @@
 #include "Ui/Windows/Construction/Construction.h"
 #include "Vehicles/OrderManager.h"
 #include "Vehicles/VehicleManager.h"
+#include "ViewportManager.h"
 
 #include <OpenLoco/Math/Vector.hpp>
+#include <bit>
 #include <bitset>
 #include <numeric>
 #include <sfl/static_vector.hpp>
@@ -37,6 +40,16 @@ namespace OpenLoco::StationManager
 
     static auto& rawStations() { return getGameState().stations; }
 
+    // Cargo queued for delivery by queueCargoToNearbyStations. Per station as the cargo
+    // distribution only needs updating once regardless of how many producers delivered to it.
+    struct QueuedCargoDelivery
+    {
+        uint32_t cargoTypes;
+        std::array<uint32_t, kMaxCargoStats> quantities;
+    };
+    static std::array<QueuedCargoDelivery, Limits::kMaxStations> _queuedDeliveries;
+    static std::vector<StationId> _queuedDeliveryStations;
+
     // 0x0048B1D8
     void reset()
     {
@@ -44,6 +57,15 @@ namespace OpenLoco::StationManager
         {
             station.name = StringIds::null;
         }
+        AirportMovementGraph::reset();
+        resetCatchmentCoverage();
+        invalidateAllCargoAcceptance();
+        for (const auto stationId : _queuedDeliveryStations)
+        {
+            _queuedDeliveries[enumValue(stationId)] = {};
+        }
+        _queuedDeliveryStations.clear();
+        Ui::ViewportManager::invalidateLabelIndex();
         Ui::Windows::Station::reset();
     }
 
@@ -458,10 +480,123 @@ namespace OpenLoco::StationManager
 
     using CargoStations = sfl::static_vector<std::pair<StationId, uint8_t>, 16>;
 
-    static CargoStations findStationsForCargoType(const uint8_t cargoType, const World::Pos2& pos, const World::TilePos2& size)
+    // Catchment radius (in tiles) that producers search around themselves for stations
+    constexpr auto kCargoCatchmentRadius = 4;
+
+    // Stations that have an element within the catchment radius of a tile. Built lazily from the
+    // tile elements as producers query them and kept up to date as stations gain or lose tiles.
+    struct CatchmentCoverage
+    {
+        bool isValid;
+        std::vector<StationId> stations;
+    };
+
+    static std::vector<CatchmentCoverage> _catchmentCoverage;
+
+    void resetCatchmentCoverage()
+    {
+        _catchmentCoverage.clear();
+    }
+
+    // Calls func with the coverage of each tile within the catchment radius of the footprint
+    template<typename TFunc>
+    static void forEachCatchmentCoverage(const TilePos2& minPos, const TilePos2& maxPos, TFunc&& func)
+    {
+        if (_catchmentCoverage.empty())
+        {
+            return;
+        }
+
+        const auto minY = std::max(minPos.y - kCargoCatchmentRadius, 0);
+        const auto maxY = std::min(maxPos.y + kCargoCatchmentRadius, World::kMapRows - 1);
+        const auto minX = std::max(minPos.x - kCargoCatchmentRadius, 0);
+        const auto maxX = std::min(maxPos.x + kCargoCatchmentRadius, World::kMapColumns - 1);
+        for (auto y = minY; y <= maxY; ++y)
+        {
+            for (auto x = minX; x <= maxX; ++x)
+            {
+                func(_catchmentCoverage[y * World::kMapColumns + x]);
+            }
+        }
+    }
+
+    void addCatchmentCoverage(const StationId stationId, const TilePos2& minPos, const TilePos2& maxPos)
+    {
+        forEachCatchmentCoverage(minPos, maxPos, [stationId](CatchmentCoverage& coverage) {
+            // Tiles that are not valid are rebuilt from the tile elements when next queried
+            if (coverage.isValid && std::find(coverage.stations.begin(), coverage.stations.end(), stationId) == coverage.stations.end())
+            {
+                coverage.stations.push_back(stationId);
+            }
+        });
+    }
+
+    void invalidateCatchmentCoverage(const TilePos2& minPos, const TilePos2& maxPos)
+    {
+        forEachCatchmentCoverage(minPos, maxPos, [](CatchmentCoverage& coverage) {
+            coverage.isValid = false;
+        });
+    }
+
+    static bool isCargoCatchmentStation(const StationElement& elStation)
+    {
+        return !elStation.isAiAllocated() && !elStation.isGhost();
+    }
+
+    static const std::vector<StationId>& getCatchmentCoverage(const TilePos2& pos)
+    {
+        if (_catchmentCoverage.empty())
+        {
+            _catchmentCoverage.resize(World::kMapSize);
+        }
+
+        auto& coverage = _catchmentCoverage[pos.y * World::kMapColumns + pos.x];
+        if (coverage.isValid)
+        {
+            return coverage.stations;
+        }
+
+        coverage.isValid = true;
+        coverage.stations.clear();
+        for (auto y = pos.y - kCargoCatchmentRadius; y <= pos.y + kCargoCatchmentRadius; ++y)
+        {
+            for (auto x = pos.x - kCargoCatchmentRadius; x <= pos.x + kCargoCatchmentRadius; ++x)
+            {
+                const auto searchLoc = TilePos2(x, y);
+                if (!World::validCoords(searchLoc))
+                {
+                    continue;
+                }
+
+                const auto tile = TileManager::get(searchLoc);
+                for (const auto& el : tile)
+                {
+                    auto* elStation = el.as<StationElement>();
+                    if (elStation == nullptr || !isCargoCatchmentStation(*elStation))
+                    {
+                        continue;
+                    }
+                    if (std::find(coverage.stations.begin(), coverage.stations.end(), elStation->stationId()) == coverage.stations.end())
+                    {
+                        coverage.stations.push_back(elStation->stationId());
+                    }
+                }
+            }
+        }
+        return coverage.stations;
+    }
+
+    static bool acceptsCargoFromProducer(const Station* station, const uint8_t cargoType)
+    {
+        return station != nullptr && (station->cargoStats[cargoType].flags & StationCargoStatsFlags::acceptedFromProducer) != StationCargoStatsFlags::none;
+    }
+
+    // Full scan of the catchment rectangle in the same order as vanilla. Only the first 16
+    // stations found are returned so this is needed whenever more than that are in range.
+    static CargoStations scanStationsForCargoType(const uint8_t cargoType, const World::Pos2& pos, const World::TilePos2& size)
     {
-        const auto initialLoc = World::toTileSpace(pos) - TilePos2(4, 4);
-        const auto catchmentSize = size + TilePos2(8, 8);
+        const auto initialLoc = World::toTileSpace(pos) - TilePos2(kCargoCatchmentRadius, kCargoCatchmentRadius);
+        const auto catchmentSize = size + TilePos2(kCargoCatchmentRadius * 2, kCargoCatchmentRadius * 2);
 
         CargoStations foundStations;
         for (TilePos2 searchOffset{ 0, 0 }; searchOffset.y < catchmentSize.y; ++searchOffset.y)
@@ -483,7 +618,7 @@ namespace OpenLoco::StationManager
                         continue;
                     }
 
-                    if (elStation->isAiAllocated() || elStation->isGhost())
+                    if (!isCargoCatchmentStation(*elStation))
                     {
                         continue;
                     }
@@ -498,11 +633,7 @@ namespace OpenLoco::StationManager
                         continue;
                     }
                     auto* station = get(elStation->stationId());
-                    if (station == nullptr)
-                    {
-                        continue;
-                    }
-                    if ((station->cargoStats[cargoType].flags & StationCargoStatsFlags::acceptedFromProducer) == StationCargoStatsFlags::none)
+                    if (!acceptsCargoFromProducer(station, cargoType))
                     {
                         continue;
                     }
@@ -516,7 +647,50 @@ namespace OpenLoco::StationManager
         return foundStations;
     }
 
-    static uint16_t deliverCargoToStations(const CargoStations& foundStations, const uint8_t cargoType, const uint8_t cargoQty)
+    static CargoStations findStationsForCargoType(const uint8_t cargoType, const World::Pos2& pos, const World::TilePos2& size)
+    {
+        // The union of the coverage of the producer's tiles is every station with an element in the
+        // catchment rectangle. Delivery does not depend on the order of the stations so this matches
+        // the full scan as long as it is not truncated.
+        const auto producerLoc = World::toTileSpace(pos);
+        CargoStations foundStations;
+        for (auto y = producerLoc.y; y < producerLoc.y + size.y; ++y)
+        {
+            for (auto x = producerLoc.x; x < producerLoc.x + size.x; ++x)
+            {
+                const auto tilePos = TilePos2(x, y);
+                if (!World::validCoords(tilePos))
+                {
+                    return scanStationsForCargoType(cargoType, pos, size);
+                }
+
+                for (const auto stationId : getCatchmentCoverage(tilePos))
+                {
+                    auto res = std::find_if(foundStations.begin(), foundStations.end(), [stationId](const std::pair<StationId, uint8_t>& item) { return item.first == stationId; });
+                    if (res != foundStations.end())
+                    {
+                        continue;
+                    }
+                    auto* station = get(stationId);
+                    if (!acceptsCargoFromProducer(station, cargoType))
+                    {
+                        continue;
+                    }
+                    if (foundStations.full())
+                    {
+                        return scanStationsForCargoType(cargoType, pos, size);
+                    }
+                    foundStations.push_back(std::make_pair(stationId, station->cargoStats[cargoType].rating));
+                }
+            }
+        }
+
+        return foundStations;
+    }
+
+    // Splits the cargo between the stations by rating calling deliver(station, share) for each
+    template<typename Func>
+    static uint16_t distributeCargoToStations(const CargoStations& foundStations, const uint8_t cargoQty, Func&& deliver)
     {
         const auto ratingTotal = std::accumulate(foundStations.begin(), foundStations.end(), 0, [](const int32_t a, const std::pair<StationId, uint8_t>& b) { return a + b.second * b.second; });
         if (ratingTotal == 0)
@@ -541,12 +715,62 @@ namespace OpenLoco::StationManager
                 share++;
             }
             cargoQtyDelivered += share;
-            station->deliverCargoToStation(cargoType, share);
+            deliver(*station, share);
         }
 
         return std::min<uint16_t>(cargoQtyDelivered, cargoQty);
     }
 
+    static uint16_t deliverCargoToStations(const CargoStations& foundStations, const uint8_t cargoType, const uint8_t cargoQty)
+    {
+        return distributeCargoToStations(foundStations, cargoQty, [cargoType](Station& station, const uint8_t share) {
+            station.deliverCargoToStation(cargoType, share);
+        });
+    }
+
+    uint16_t queueCargoToNearbyStations(const uint8_t cargoType, const uint8_t cargoQty, const World::Pos2& pos, const World::TilePos2& size)
+    {
+        const auto foundStations = findStationsForCargoType(cargoType, pos, size);
+        if (foundStations.empty())
+        {
+            return 0;
+        }
+
+        // The shares only depend on the ratings which do not change until the stations next update
+        // so the amount delivered is known now even though the station is not updated until the flush.
+        return distributeCargoToStations(foundStations, cargoQty, [cargoType](Station& station, const uint8_t share) {
+            auto& queued = _queuedDeliveries[enumValue(station.id())];
+            if (queued.cargoTypes == 0)
+            {
+                _queuedDeliveryStations.push_back(station.id());
+            }
+            // Even a share of 0 marks the cargo as originating from the station
+            queued.cargoTypes |= 1U << cargoType;
+            queued.quantities[cargoType] += share;
+        });
+    }
+
+    void flushQueuedCargoDeliveries()
+    {
+        for (const auto stationId : _queuedDeliveryStations)
+        {
+            auto& queued = _queuedDeliveries[enumValue(stationId)];
+            auto* station = get(stationId);
+            if (station != nullptr && !station->empty())
+            {
+                // Bounded addition of the total is the same as bounded addition of each share in turn
+                for (auto cargoTypes = queued.cargoTypes; cargoTypes != 0; cargoTypes &= cargoTypes - 1)
+                {
+                    const auto cargoType = static_cast<uint8_t>(std::countr_zero(cargoTypes));
+                    station->addProducedCargo(cargoType, queued.quantities[cargoType]);
+                }
+                station->updateCargoDistribution();
+            }
+            queued = {};
+        }
+        _queuedDeliveryStations.clear();
+    }
+
     // 0x0042F2FE
     uint16_t deliverCargoToNearbyStations(const uint8_t cargoType, const uint8_t cargoQty, const World::Pos2& pos, const World::TilePos2& size)
     {
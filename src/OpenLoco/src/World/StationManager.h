@@ -20,8 +20,16 @@ namespace OpenLoco::StationManager
     void updateDaily();
     StringId generateNewStationName(StationId stationId, TownId townId, World::Pos3 position, uint8_t mode);
     void zeroUnused();
+    // Keep the stations in range of producers up to date, the positions are the footprint of the station
+    // element(s) that were added, removed or stopped being a ghost/AI allocated.
+    void resetCatchmentCoverage();
+    void addCatchmentCoverage(const StationId stationId, const World::TilePos2& minPos, const World::TilePos2& maxPos);
+    void invalidateCatchmentCoverage(const World::TilePos2& minPos, const World::TilePos2& maxPos);
     uint16_t deliverCargoToNearbyStations(const uint8_t cargoType, const uint8_t cargoQty, const World::Pos2& pos, const World::TilePos2& size);
     uint16_t deliverCargoToStations(std::span<const StationId> stations, const uint8_t cargoType, const uint8_t cargoQty);
+    // As deliverCargoToNearbyStations but the stations are only updated by flushQueuedCargoDeliveries
+    uint16_t queueCargoToNearbyStations(const uint8_t cargoType, const uint8_t cargoQty, const World::Pos2& pos, const World::TilePos2& size);
+    void flushQueuedCargoDeliveries();
     bool exceedsStationSize(Station& station, World::Pos3 pos);
     StationId allocateNewStation(const World::Pos3 pos, const CompanyId owner, const uint8_t mode);
     void deallocateStation(const StationId stationId);
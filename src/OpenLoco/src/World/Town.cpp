@@ -34,6 +34,7 @@
 #include <OpenLoco/Core/Numerics.hpp>
 #include <algorithm>
 #include <bit>
+#include <bitset>
 
 using namespace OpenLoco::World;
 
@@ -128,6 +129,7 @@ namespace OpenLoco
             labelFrame.top[zoomLevel] = yOffset >> zoomLevel;
             labelFrame.bottom[zoomLevel] = (yOffset + nameHeight) >> zoomLevel;
         }
+        Ui::ViewportManager::invalidateLabelIndex();
     }
 
     // 0x0049749B
@@ -848,6 +850,7 @@ namespace OpenLoco
                 }
                 elRoad->setOwner(newOwner);
                 elRoad->setRoadObjectId(newRoadObjId);
+                invalidateTownRoadExtents(roadPos);
                 if (!elRoad->hasLevelCrossing())
                 {
                     elRoad->setStreetLightStyle(newStreetLightStyle);
@@ -1515,78 +1518,170 @@ namespace OpenLoco
         bool isBridge;
     };
 
-    // 0x00497FFC
-    static std::optional<RoadExtentResult> findRoadExtent(const Town& town)
+    // 0x00497F74
+    // Returns the first road on the tile that the town could extend from
+    static World::RoadElement* findTownExtendableRoad(const World::Pos2& loc)
     {
-        struct FindResult
+        auto tile = World::TileManager::get(loc);
+        bool hasPassedSurface = false;
+        for (auto& el : tile)
         {
-            World::Pos2 loc;
-            World::RoadElement* elRoad;
-        };
+            auto* elSurface = el.as<World::SurfaceElement>();
+            if (elSurface != nullptr)
+            {
+                hasPassedSurface = true;
+                continue;
+            }
+            if (!hasPassedSurface)
+            {
+                continue;
+            }
+            auto* elRoad = el.as<World::RoadElement>();
+            if (elRoad == nullptr)
+            {
+                continue;
+            }
+            if (elRoad->isGhost() || elRoad->isAiAllocated())
+            {
+                continue;
+            }
+            if (elRoad->sequenceIndex() != 0)
+            {
+                continue;
+            }
+            auto* roadObj = ObjectManager::get<RoadObject>(elRoad->roadObjectId());
+            if (!roadObj->hasFlags(RoadObjectFlags::anyRoadTypeCompatible))
+            {
+                continue;
+            }
+            return elRoad;
+        }
+        return nullptr;
+    }
 
-        std::optional<FindResult> res;
+    static constexpr auto kRoadExtentSearchRange = kSquareSearchRange<9>;
 
-        // 0x00497F74
-        auto validRoad = [randVal = town.prng.srand_0(), &res](const World::Pos2& loc) mutable {
-            auto tile = World::TileManager::get(loc);
-            bool hasPassedSurface = false;
-            for (auto& el : tile)
+    // Which tiles of the square search around a town centre have a road the town could extend from.
+    // The result only depends on the tiles so it is keyed by the centre rather than the town.
+    struct RoadExtentCache
+    {
+        World::Pos2 centre;
+        bool isValid;
+        std::bitset<kRoadExtentSearchRange.size()> hasRoad;
+    };
+    static std::array<RoadExtentCache, Limits::kMaxTowns> _roadExtentCaches;
+
+    static std::bitset<kRoadExtentSearchRange.size()> scanRoadExtent(const World::Pos2& centre)
+    {
+        std::bitset<kRoadExtentSearchRange.size()> hasRoad;
+        for (auto i = 0U; i < kRoadExtentSearchRange.size(); ++i)
+        {
+            const World::Pos2 pos = World::toWorldSpace(kRoadExtentSearchRange[i]) + centre;
+            if (World::validCoords(pos) && findTownExtendableRoad(pos) != nullptr)
             {
-                auto* elSurface = el.as<World::SurfaceElement>();
-                if (elSurface != nullptr)
-                {
-                    hasPassedSurface = true;
-                    continue;
-                }
-                if (!hasPassedSurface)
-                {
-                    continue;
-                }
-                auto* elRoad = el.as<World::RoadElement>();
-                if (elRoad == nullptr)
-                {
-                    continue;
-                }
-                if (elRoad->isGhost() || elRoad->isAiAllocated())
-                {
-                    continue;
-                }
-                if (elRoad->sequenceIndex() != 0)
-                {
-                    continue;
-                }
-                auto* roadObj = ObjectManager::get<RoadObject>(elRoad->roadObjectId());
-                if (!roadObj->hasFlags(RoadObjectFlags::anyRoadTypeCompatible))
+                hasRoad.set(i);
+            }
+        }
+        return hasRoad;
+    }
+
+    static const std::bitset<kRoadExtentSearchRange.size()>& getRoadExtentCandidates(const Town& town)
+    {
+        const World::Pos2 centre{ town.x, town.y };
+        auto& cache = _roadExtentCaches[enumValue(town.id())];
+        if (!cache.isValid || cache.centre != centre)
+        {
+            cache.centre = centre;
+            cache.hasRoad = scanRoadExtent(centre);
+            cache.isValid = true;
+        }
+        assert(cache.hasRoad == scanRoadExtent(centre));
+        return cache.hasRoad;
+    }
+
+    void invalidateTownRoadExtents(const World::Pos2& pos)
+    {
+        // Square search covers -5 to +4 tiles around the centre
+        const auto tilePos = World::toTileSpace(pos);
+        for (auto& cache : _roadExtentCaches)
+        {
+            if (!cache.isValid)
+            {
+                continue;
+            }
+            const auto centre = World::toTileSpace(cache.centre);
+            if (std::abs(tilePos.x - centre.x) <= 5 && std::abs(tilePos.y - centre.y) <= 5)
+            {
+                cache.isValid = false;
+            }
+        }
+    }
+
+    void invalidateAllTownRoadExtents()
+    {
+        for (auto& cache : _roadExtentCaches)
+        {
+            cache.isValid = false;
+        }
+    }
+
+    // Picks one of the candidate tiles, each later candidate has a 50% chance of replacing the previous pick
+    static std::optional<World::Pos2> pickRoadExtentTile(const Town& town, const std::bitset<kRoadExtentSearchRange.size()>& hasRoad)
+    {
+        std::optional<World::Pos2> res;
+        auto randVal = town.prng.srand_0();
+        for (auto i = 0U; i < kRoadExtentSearchRange.size(); ++i)
+        {
+            if (!hasRoad.test(i))
+            {
+                continue;
+            }
+            // There is a 50% chance that it will use a new result
+            if (res.has_value())
+            {
+                bool bitRes = randVal & 1;
+                randVal = std::rotr(randVal, 1);
+                if (bitRes)
                 {
                     continue;
                 }
-                // There is a 50% chance that it will use a new result
-                if (res.has_value())
-                {
-                    bool bitRes = randVal & 1;
-                    randVal = std::rotr(randVal, 1);
-                    if (bitRes)
-                    {
-                        return true;
-                    }
-                }
-                res = FindResult{ loc, elRoad };
-                return true;
             }
-            return true;
-        };
-        squareSearch({ town.x, town.y }, 9, validRoad);
+            res = World::toWorldSpace(kRoadExtentSearchRange[i]) + World::Pos2{ town.x, town.y };
+        }
+        return res;
+    }
 
+    // 0x00497FFC
+    static std::optional<RoadExtentResult> findRoadExtent(const Town& town)
+    {
+        auto res = pickRoadExtentTile(town, getRoadExtentCandidates(town));
         if (!res.has_value())
         {
             return std::nullopt;
         }
 
-        auto& roadPiece = World::TrackData::getRoadPiece(res->elRoad->roadId());
+        auto* elRoad = findTownExtendableRoad(*res);
+        if (elRoad == nullptr)
+        {
+            // The road was changed without invalidating the cache, rescan so the pick matches a full search
+            _roadExtentCaches[enumValue(town.id())].isValid = false;
+            res = pickRoadExtentTile(town, getRoadExtentCandidates(town));
+            if (!res.has_value())
+            {
+                return std::nullopt;
+            }
+            elRoad = findTownExtendableRoad(*res);
+            if (elRoad == nullptr)
+            {
+                return std::nullopt;
+            }
+        }
+
+        auto& roadPiece = World::TrackData::getRoadPiece(elRoad->roadId());
         return RoadExtentResult{
-            World::Pos3(res->loc, res->elRoad->baseHeight() - roadPiece[0].z),
-            static_cast<uint16_t>((res->elRoad->roadId() << 3) | res->elRoad->rotation()),
-            res->elRoad->hasBridge()
+            World::Pos3(*res, elRoad->baseHeight() - roadPiece[0].z),
+            static_cast<uint16_t>((elRoad->roadId() << 3) | elRoad->rotation()),
+            elRoad->hasBridge()
         };
     }
 
@@ -89,4 +89,8 @@ namespace OpenLoco
         void grow(TownGrowFlags growFlags);
         StringId getTownSizeString() const;
     };
+
+    // Marks the cached road search of towns near pos as out of date (e.g. after a road is built or removed)
+    void invalidateTownRoadExtents(const World::Pos2& pos);
+    void invalidateAllTownRoadExtents();
 }
@@ -19,8 +19,12 @@
 #include "Scenario/ScenarioManager.h"
 #include "SceneManager.h"
 #include "Ui/WindowManager.h"
+#include "ViewportManager.h"
 #include <OpenLoco/Core/EnumFlags.hpp>
 #include <OpenLoco/Core/Numerics.hpp>
+#include <OpenLoco/Diagnostics/Logging.h>
+#include <algorithm>
+#include <vector>
 
 using namespace OpenLoco::World;
 
@@ -289,8 +293,10 @@ namespace OpenLoco::TownManager
         if (!generateTownName(town))
         {
             town->name = StringIds::null;
+            invalidateTownGrid();
             return nullptr;
         }
+        invalidateTownGrid();
 
         // Figure out if we need to reset building influence
         for (auto& otherTown : towns())
@@ -300,7 +306,7 @@ namespace OpenLoco::TownManager
                 continue;
             }
 
-            resetBuildingsInfluence();
+            reassignBuildingsInfluence(town->id());
             break;
         }
 
@@ -424,6 +430,9 @@ namespace OpenLoco::TownManager
         {
             town.name = StringIds::null;
         }
+        invalidateTownGrid();
+        invalidateAllTownRoadExtents();
+        Ui::ViewportManager::invalidateLabelIndex();
         Ui::Windows::TownList::reset();
     }
 
@@ -480,19 +489,109 @@ namespace OpenLoco::TownManager
         Ui::WindowManager::invalidate(Ui::WindowType::town);
     }
 
+    // Coarse grid of the towns that could be the closest town to some location within each cell.
+    // Town positions never change so it only needs rebuilding when towns are created or removed.
+    constexpr int32_t kTownGridCellSize = 16 * World::kTileSize;
+    constexpr int32_t kTownGridColumns = World::kMapWidth / kTownGridCellSize;
+    constexpr int32_t kTownGridRows = World::kMapHeight / kTownGridCellSize;
+
+    static std::array<std::vector<TownId>, kTownGridColumns * kTownGridRows> _townGrid;
+    static bool _townGridIsValid = false;
+
+    void invalidateTownGrid()
+    {
+        _townGridIsValid = false;
+    }
+
+    // Distance from coord to the nearest and furthest points of the range [min, max]
+    static std::pair<int32_t, int32_t> getAxisDistanceRange(const int32_t coord, const int32_t min, const int32_t max)
+    {
+        const auto nearest = std::max({ 0, min - coord, coord - max });
+        const auto furthest = std::max(std::abs(coord - min), std::abs(coord - max));
+        return std::make_pair(nearest, furthest);
+    }
+
+    // Manhattan distance from the town to the nearest and furthest points of the cell
+    static std::pair<int32_t, int32_t> getTownDistanceRange(const Town& town, const World::Pos2& cellMin, const World::Pos2& cellMax)
+    {
+        const auto [nearestX, furthestX] = getAxisDistanceRange(town.x, cellMin.x, cellMax.x);
+        const auto [nearestY, furthestY] = getAxisDistanceRange(town.y, cellMin.y, cellMax.y);
+        return std::make_pair(nearestX + nearestY, furthestX + furthestY);
+    }
+
+    static void rebuildTownGrid()
+    {
+        for (auto cellY = 0; cellY < kTownGridRows; ++cellY)
+        {
+            for (auto cellX = 0; cellX < kTownGridColumns; ++cellX)
+            {
+                const auto cellMin = World::Pos2(cellX * kTownGridCellSize, cellY * kTownGridCellSize);
+                const auto cellMax = cellMin + World::Pos2(kTownGridCellSize - 1, kTownGridCellSize - 1);
+
+                // Every location in the cell is at most this far from its closest town so any town
+                // that can not get this close is never the closest
+                int32_t closestFurthestDistance = std::numeric_limits<int32_t>::max();
+                for (const auto& town : towns())
+                {
+                    closestFurthestDistance = std::min(closestFurthestDistance, getTownDistanceRange(town, cellMin, cellMax).second);
+                }
+
+                auto& candidates = _townGrid[cellY * kTownGridColumns + cellX];
+                candidates.clear();
+                for (const auto& town : towns())
+                {
+                    if (getTownDistanceRange(town, cellMin, cellMax).first <= closestFurthestDistance)
+                    {
+                        candidates.push_back(town.id());
+                    }
+                }
+            }
+        }
+        _townGridIsValid = true;
+    }
+
+    // Returns nullptr if the location is outside of the grid and all towns need to be considered
+    static const std::vector<TownId>* getTownGridCandidates(const World::Pos2& loc)
+    {
+        if (!World::validCoords(loc))
+        {
+            return nullptr;
+        }
+        if (!_townGridIsValid)
+        {
+            rebuildTownGrid();
+        }
+        return &_townGrid[(loc.y / kTownGridCellSize) * kTownGridColumns + loc.x / kTownGridCellSize];
+    }
+
     // 0x00497E52
     std::optional<std::pair<TownId, uint8_t>> getClosestTownAndDensity(const World::Pos2& loc)
     {
         int32_t closestDistance = std::numeric_limits<uint16_t>::max();
         auto closestTown = TownId::null; // ebx
-        for (const auto& town : towns())
-        {
+        const auto considerTown = [&closestDistance, &closestTown, &loc](const Town& town) {
             const auto distance = Math::Vector::manhattanDistance2D(World::Pos2(town.x, town.y), loc);
             if (distance < closestDistance)
             {
                 closestDistance = distance;
                 closestTown = town.id();
             }
+        };
+
+        // Candidates are in id order so ties are resolved the same way as a search of every town
+        if (const auto* candidates = getTownGridCandidates(loc); candidates != nullptr)
+        {
+            for (const auto townId : *candidates)
+            {
+                considerTown(*get(townId));
+            }
+        }
+        else
+        {
+            for (const auto& town : towns())
+            {
+                considerTown(town);
+            }
         }
 
         if (closestDistance == std::numeric_limits<uint16_t>::max())
@@ -512,6 +611,129 @@ namespace OpenLoco::TownManager
         const uint8_t density = std::min(4 - unk, 3); // edx
         return { std::make_pair(town->id(), density) };
     }
+
+    // Closest town as getClosestTownAndDensity would find it with changedTown either present or not
+    static TownId findClosestTownWithOrWithout(const World::Pos2& loc, const TownId changedTown, const bool includeChangedTown)
+    {
+        int32_t closestDistance = std::numeric_limits<uint16_t>::max();
+        auto closestTown = TownId::null;
+        for (const auto& town : rawTowns())
+        {
+            const bool isChangedTown = town.id() == changedTown;
+            if (isChangedTown ? !includeChangedTown : town.empty())
+            {
+                continue;
+            }
+            const auto distance = Math::Vector::manhattanDistance2D(World::Pos2(town.x, town.y), loc);
+            if (distance < closestDistance)
+            {
+                closestDistance = distance;
+                closestTown = town.id();
+            }
+        }
+        return closestTown;
+    }
+
+    static void addBuildingInfluence(Town& town, const BuildingObject& buildingObj, const bool isConstructed, const int32_t sign)
+    {
+        const auto producedQuantity = buildingObj.producedQuantity[0];
+        town.populationCapacity += sign * producedQuantity;
+        if (isConstructed)
+        {
+            town.population += sign * producedQuantity;
+        }
+        if (town.numBuildings + sign <= std::numeric_limits<int16_t>::max())
+        {
+            town.numBuildings += sign;
+        }
+        if (buildingObj.var_AC != 0xFF)
+        {
+            town.var_150[buildingObj.var_AC] += sign;
+        }
+    }
+
+#ifndef NDEBUG
+    // Cross checks the incremental totals against a full rebuild, which is kept as it is authoritative
+    static void verifyBuildingsInfluence()
+    {
+        const auto incrementalTowns = rawTowns();
+        resetBuildingsInfluence();
+        for (const auto& town : towns())
+        {
+            const auto& incremental = incrementalTowns[enumValue(town.id())];
+            if (incremental.numBuildings != town.numBuildings
+                || incremental.population != town.population
+                || incremental.populationCapacity != town.populationCapacity
+                || !std::equal(std::begin(incremental.var_150), std::end(incremental.var_150), std::begin(town.var_150)))
+            {
+                Diagnostics::Logging::error("Town {} has stale building influence", enumValue(town.id()));
+            }
+        }
+    }
+#endif
+
+    // Buildings count towards their closest town so creating or removing a town can only move
+    // buildings that are near enough to it for it to be (or have been) their closest town.
+    // The position of a removed town is still stored so the same area can be found either way.
+    void reassignBuildingsInfluence(const TownId changedTownId)
+    {
+        const auto& changedTown = rawTowns()[enumValue(changedTownId)];
+        const bool isRemoved = changedTown.empty();
+
+        for (auto cellY = 0; cellY < kTownGridRows; ++cellY)
+        {
+            for (auto cellX = 0; cellX < kTownGridColumns; ++cellX)
+            {
+                const auto cellMin = World::Pos2(cellX * kTownGridCellSize, cellY * kTownGridCellSize);
+                const auto cellMax = cellMin + World::Pos2(kTownGridCellSize - 1, kTownGridCellSize - 1);
+
+                int32_t closestFurthestDistance = getTownDistanceRange(changedTown, cellMin, cellMax).second;
+                for (const auto& town : towns())
+                {
+                    closestFurthestDistance = std::min(closestFurthestDistance, getTownDistanceRange(town, cellMin, cellMax).second);
+                }
+                if (getTownDistanceRange(changedTown, cellMin, cellMax).first > closestFurthestDistance)
+                {
+                    continue;
+                }
+
+                for (const auto& tilePos : World::TilePosRangeView(World::toTileSpace(cellMin), World::toTileSpace(cellMax)))
+                {
+                    auto tile = World::TileManager::get(tilePos);
+                    for (auto& element : tile)
+                    {
+                        auto* building = element.as<World::BuildingElement>();
+                        if (building == nullptr || building->isGhost() || building->isMiscBuilding() || building->sequenceIndex() != 0)
+                        {
+                            continue;
+                        }
+
+                        const auto pos = World::toWorldSpace(tilePos);
+                        const auto oldTownId = findClosestTownWithOrWithout(pos, changedTownId, isRemoved);
+                        const auto newTownId = findClosestTownWithOrWithout(pos, changedTownId, !isRemoved);
+                        if (oldTownId == newTownId)
+                        {
+                            continue;
+                        }
+
+                        const auto* buildingObj = ObjectManager::get<BuildingObject>(building->objectId());
+                        if (oldTownId != TownId::null)
+                        {
+                            addBuildingInfluence(rawTowns()[enumValue(oldTownId)], *buildingObj, building->isConstructed(), -1);
+                        }
+                        if (newTownId != TownId::null)
+                        {
+                            addBuildingInfluence(rawTowns()[enumValue(newTownId)], *buildingObj, building->isConstructed(), 1);
+                        }
+                    }
+                }
+            }
+        }
+#ifndef NDEBUG
+        verifyBuildingsInfluence();
+#endif
+        Gfx::invalidateScreen();
+    }
 }
 
 OpenLoco::TownId OpenLoco::Town::id() const
@@ -13,9 +13,12 @@ namespace OpenLoco::TownManager
     FixedVector<Town, Limits::kMaxTowns> towns();
     Town* get(TownId id);
     std::optional<std::pair<TownId, uint8_t>> getClosestTownAndDensity(const World::Pos2& loc);
+    // Must be called whenever a town is created or removed
+    void invalidateTownGrid();
     void update();
     void updateLabels();
     void updateMonthly();
     Town* updateTownInfo(const World::Pos2& loc, uint32_t population, uint32_t populationCapacity, int16_t rating, int16_t numBuildings);
     void resetBuildingsInfluence();
+    void reassignBuildingsInfluence(TownId townId);
 }